@@ -22,7 +22,7 @@ public class Eclipser : ModuleRules
 			"GeometryCore"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] { "GeometryFramework" });
+		PrivateDependencyModuleNames.AddRange(new string[] { "GeometryFramework", "DynamicMesh", "Json" });
 
 		PublicIncludePaths.AddRange(new string[] {
 			"Eclipser",
@@ -11,8 +11,11 @@
 #include "EnhancedInputSubsystems.h"
 #include "InputActionValue.h"
 #include "Eclipser.h"
+#include "EngineUtils.h"
 #include "Kismet/GameplayStatics.h"
-#include "Planet/Voxel/VoxelChunk.h"
+#include "Planet/Planet.h"
+#include "Planet/Voxel/VoxelManager.h"
+#include "Planet/Voxel/VoxelNetComponent.h"
 
 AEclipserCharacter::AEclipserCharacter()
 {
@@ -139,14 +142,35 @@ void AEclipserCharacter::PerformDig()
     if (!UGameplayStatics::DeprojectScreenToWorld(PC, ViewportCenter, TraceStart, Forward)) return;
 
 	const FVector TraceEnd = TraceStart + Forward * MaxDigDistance;
-	FHitResult HitResult;
-	GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, DigTraceChannel);
-	
-	if (UVoxelChunk* HitChunk = Cast<UVoxelChunk>(HitResult.GetComponent()))
+
+	// Collision Cooking 여부와 관계없이 Density 필드에 직접 Ray 검사, 가장 가까운 Planet 표면을 팜
+	UVoxelManager* HitManager = nullptr;
+	FVoxelRaycastHit ClosestHit;
+	for (TActorIterator<APlanet> It(GetWorld()); It; ++It)
 	{
-		if (UVoxelManager* Manager = HitChunk->GetVoxelManager())
+		UVoxelManager* Manager = It->VoxelManager;
+		FVoxelRaycastHit Hit;
+		if (IsValid(Manager) && Manager->Raycast(TraceStart, TraceEnd, Hit))
+		{
+			if (!HitManager || Hit.Distance < ClosestHit.Distance)
+			{
+				HitManager = Manager;
+				ClosestHit = Hit;
+			}
+		}
+	}
+
+	if (HitManager)
+	{
+		// 멀티플레이에서는 서버를 거쳐서 모든 Client에 같은 Sculpt가 적용됨
+		UVoxelNetComponent* NetComponent = GetController() ? GetController()->FindComponentByClass<UVoxelNetComponent>() : nullptr;
+		if (NetComponent)
+		{
+			NetComponent->RequestSculpt(HitManager, ClosestHit.ImpactPoint, DigRadius);
+		}
+		else
 		{
-			Manager->Sculpt(HitResult.ImpactPoint, DigRadius);
+			HitManager->Sculpt(ClosestHit.ImpactPoint, DigRadius);
 		}
 	}
 
@@ -97,6 +97,9 @@ public:
 	/** Returns FollowCamera subobject **/
 	FORCEINLINE class UCameraComponent* GetFollowCamera() const { return FollowCamera; }
 
+	// 화면 중앙 Ray의 시작점(Camera)부터 파는 지점까지 최대 거리
+	float GetMaxDigDistance() const { return MaxDigDistance; }
+
 private:
 
 	void OnDigPressed();
@@ -108,9 +111,6 @@ private:
 	UPROPERTY(EditAnywhere, Category="Dig")
 	float DigInterval = 0.3f;
 
-	UPROPERTY(EditAnywhere, Category="Dig")
-	TEnumAsByte<ECollisionChannel> DigTraceChannel = ECC_Visibility;
-
 	UPROPERTY(EditAnywhere, Category="Dig")
 	float MaxDigDistance = 300.f;  // // 플레이어와 파는 지점 간 최대 거리
 
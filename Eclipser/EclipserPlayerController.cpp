@@ -8,9 +8,15 @@
 #include "InputActionValue.h"
 #include "Blueprint/UserWidget.h"
 #include "Eclipser.h"
+#include "Planet/Voxel/VoxelNetComponent.h"
 #include "Widget/HUD/HUDWidget.h"
 #include "Widgets/Input/SVirtualJoystick.h"
 
+AEclipserPlayerController::AEclipserPlayerController()
+{
+	VoxelNetComponent = CreateDefaultSubobject<UVoxelNetComponent>(TEXT("VoxelNetComponent"));
+}
+
 void AEclipserPlayerController::BeginPlay()
 {
 	Super::BeginPlay();
@@ -10,6 +10,7 @@ class UHUDWidget;
 class UInputMappingContext;
 class UUserWidget;
 class UInputAction;
+class UVoxelNetComponent;
 
 /**
  *  Basic PlayerController class for a third person game
@@ -19,6 +20,9 @@ UCLASS(abstract)
 class AEclipserPlayerController : public APlayerController
 {
 	GENERATED_BODY()
+
+public:
+	AEclipserPlayerController();
 	
 protected:
 
@@ -54,6 +58,10 @@ private:
 	UPROPERTY()
 	TObjectPtr<UHUDWidget> HudWidget;
 
+	/** Planet Sculpt replication */
+	UPROPERTY(VisibleAnywhere, Category = "Voxel", meta=(AllowPrivateAccess = true))
+	TObjectPtr<UVoxelNetComponent> VoxelNetComponent;
+
 	void CreateHUDWidget();
 
 };
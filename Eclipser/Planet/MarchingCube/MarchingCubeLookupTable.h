@@ -1,7 +1,11 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
 class MarchingCubeLooupTable
 {
 public:
-	inline static const int EdgeVertexIndices[12][2] = {
+	static constexpr int EdgeVertexIndices[12][2] = {
 		{0, 1}, {1, 2}, {2, 3}, {3, 0},
 		{4, 5}, {5, 6}, {6, 7}, {7, 4},
 		{0, 4}, {1, 5}, {2, 6}, {3, 7}
@@ -9,7 +13,7 @@ public:
 		
 
 	
-   inline static const int EdgeTable[256] = {
+   static constexpr int EdgeTable[256] = {
        0x0  , 0x109, 0x203, 0x30a, 0x406, 0x50f, 0x605, 0x70c,
        0x80c, 0x905, 0xa0f, 0xb06, 0xc0a, 0xd03, 0xe09, 0xf00,
        0x190, 0x99 , 0x393, 0x29a, 0x596, 0x49f, 0x795, 0x69c,
@@ -44,7 +48,7 @@ public:
        0x70c, 0x605, 0x50f, 0x406, 0x30a, 0x203, 0x109, 0x0
     };
 
-    inline static const int TriTable[256][16] =
+    static constexpr int TriTable[256][16] =
     { {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
     {0, 8, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
     {0, 1, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
@@ -301,4 +305,107 @@ public:
     {0, 9, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
     {0, 3, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
     {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1} };
-};
\ No newline at end of file
+};
+
+/*
+ * TriTable을 컴파일 타임에 압축한 Case Table
+ * Case마다 정점이 필요한 Edge 목록과 그 목록 기준의 삼각형 Index를 미리 만들어 두어서
+ * Mesher가 12개 Edge Bit 검사나 -1 Sentinel 탐색 없이 개수만큼만 순회
+ *
+ *	 Z+  (Up)
+ *	 ↑
+ *	 │        (2)──────(6)
+ *	 │       /│        /│
+ *	 │    (1)──────(5)  │
+ *	 │     │ │      │   │
+ *	 │     │(3)-----│--/ (7)
+ *	 │     │/       │ /
+ *	 │   (0)──────(4) ────→ Y+ (Right)
+ *	 │
+ *	 X+ (Forward) : (0) -> (3) 방향
+ */
+struct FMarchingCubeCompactCase
+{
+	uint8 EdgeCount = 0;
+	uint8 TriangleCount = 0;
+	uint8 Edges[12] = {}; // 정점이 필요한 Edge (오름차순)
+	uint8 Triangles[15] = {}; // Edges 기준 Local Index, 출력 Winding 순서
+};
+
+struct FMarchingCubeCaseTable
+{
+	FMarchingCubeCompactCase Cases[256];
+};
+
+class MarchingCubeCompactTable
+{
+public:
+	// Cell 꼭짓점 번호 -> Cell 최소 꼭짓점 기준 (X, Y, Z) Offset
+	static constexpr uint8 CornerOffsets[8][3] = {
+		{0, 0, 0}, {0, 0, 1}, {1, 0, 1}, {1, 0, 0},
+		{0, 1, 0}, {0, 1, 1}, {1, 1, 1}, {1, 1, 0}
+	};
+
+	// Edge의 (Lower, Upper) 꼭짓점, Lower 꼭짓점 + Axis가 Edge Cache의 Key
+	static constexpr uint8 EdgeCorners[12][2] = {
+		{0, 1}, {1, 2}, {3, 2}, {0, 3},
+		{4, 5}, {5, 6}, {7, 6}, {4, 7},
+		{0, 4}, {1, 5}, {2, 6}, {3, 7}
+	};
+	static constexpr uint8 EdgeAxis[12] = { 2, 0, 2, 0, 2, 0, 2, 0, 1, 1, 1, 1 };
+
+	static constexpr FMarchingCubeCaseTable Table = []()
+	{
+		FMarchingCubeCaseTable Result;
+		for (int32 CubeIndex = 0; CubeIndex < 256; ++CubeIndex)
+		{
+			FMarchingCubeCompactCase& Case = Result.Cases[CubeIndex];
+			const int (&Tri)[16] = MarchingCubeLooupTable::TriTable[CubeIndex];
+
+			bool bUsed[12] = {};
+			int32 IndexNum = 0;
+			for (; IndexNum < 16 && Tri[IndexNum] != -1; ++IndexNum)
+			{
+				bUsed[Tri[IndexNum]] = true;
+			}
+
+			uint8 Slot[12] = {};
+			for (int32 Edge = 0; Edge < 12; ++Edge)
+			{
+				if (bUsed[Edge])
+				{
+					Slot[Edge] = Case.EdgeCount;
+					Case.Edges[Case.EdgeCount++] = static_cast<uint8>(Edge);
+				}
+			}
+
+			// 기존 Mesher와 같은 (2, 1, 0) 순서로 뒤집어서 저장
+			Case.TriangleCount = static_cast<uint8>(IndexNum / 3);
+			for (int32 i = 0; i < IndexNum; i += 3)
+			{
+				Case.Triangles[i] = Slot[Tri[i + 2]];
+				Case.Triangles[i + 1] = Slot[Tri[i + 1]];
+				Case.Triangles[i + 2] = Slot[Tri[i]];
+			}
+		}
+		return Result;
+	}();
+
+	static constexpr bool MatchesEdgeTable()
+	{
+		for (int32 CubeIndex = 0; CubeIndex < 256; ++CubeIndex)
+		{
+			int32 Mask = 0;
+			for (int32 i = 0; i < Table.Cases[CubeIndex].EdgeCount; ++i)
+			{
+				Mask |= 1 << Table.Cases[CubeIndex].Edges[i];
+			}
+			if (Mask != MarchingCubeLooupTable::EdgeTable[CubeIndex])
+				return false;
+		}
+		return true;
+	}
+};
+
+static_assert(MarchingCubeCompactTable::MatchesEdgeTable(), "Compact case table must use exactly the edges of EdgeTable");
+static_assert(sizeof(FMarchingCubeCaseTable) <= 8 * 1024, "Compact case table should stay within a few KB");
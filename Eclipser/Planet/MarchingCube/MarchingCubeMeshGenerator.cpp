@@ -1,141 +1,355 @@
 #include "MarchingCubeMeshGenerator.h"
 #include "MarchingCubeLookupTable.h"
+#include "Planet/Voxel/Defines/VoxelStats.h"
 #include "Planet/Voxel/etc/VoxelHelper.h"
 
-FVoxelData MarchingCubeMeshGenerator::GenerateChunkMesh(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData)
+namespace
 {
-	FVoxelData ChunkMeshData;
+	// Z 방향으로 두 층만 유지하는 Edge -> 정점 Index Cache, Worker Thread마다 재사용
+	struct FEdgeCacheScratch
+	{
+		TArray<int32> Slabs[2];
+		TArray<uint64> SignMasks;
+	};
+
+	FEdgeCacheScratch& GetEdgeCacheScratch()
+	{
+		static thread_local FEdgeCacheScratch Scratch;
+		return Scratch;
+	}
 
-	const int32 RequestedStep = FMath::Max(Info.LODLevel, 1);
-	
-	for (int z = 0; z < Info.CellNum; z += RequestedStep)
+	// 실행 중에 CellNum, LOD Step이 정해지는 일반 격자, 나누어 떨어지지 않으면 마지막 Cell은 남은 크기만 사용
+	struct FRuntimeLattice
 	{
-		const int32 StepZ = FMath::Min(RequestedStep, Info.CellNum - z);
-		
-		for (int y = 0; y < Info.CellNum; y += RequestedStep)
+		const FChunkSettingInfo& Info;
+		const int32 Step;
+		const int32 LatticeNum;
+		const int32 LatticeDim;
+
+		explicit FRuntimeLattice(const FChunkSettingInfo& InInfo)
+			: Info(InInfo)
+			, Step(FMath::Max(InInfo.LODLevel, 1))
+			, LatticeNum(FMath::DivideAndRoundUp(InInfo.CellNum, Step))
+			, LatticeDim(LatticeNum + 1)
 		{
-			const int32 StepY = FMath::Min(RequestedStep, Info.CellNum - y);
+		}
+
+		int32 LatticeToCorner(int32 Lattice) const { return FMath::Min(Lattice * Step, Info.CellNum); }
+		int32 GetIndex(int32 X, int32 Y, int32 Z) const { return VoxelHelper::GetIndex(X, Y, Z, Info); }
 
-			for (int x = 0; x < Info.CellNum; x += RequestedStep)
+		void GetCellCorners(int32 i, int32 j, int32 k, FIntVector (&OutCorners)[8], int32 (&OutIndices)[8]) const
+		{
+			for (int32 c = 0; c < 8; ++c)
 			{
-				const int32 StepX = FMath::Min(RequestedStep, Info.CellNum - x);
-				const FIntVector StepVector(StepX, StepY, StepZ);
-				
-				FVoxelData CellMeshData = GenerateCellMesh(Info, VertexDensityData, FIntVector(x, y, z), StepVector);
+				const uint8* Offset = MarchingCubeCompactTable::CornerOffsets[c];
+				OutCorners[c] = FIntVector(LatticeToCorner(i + Offset[0]), LatticeToCorner(j + Offset[1]), LatticeToCorner(k + Offset[2]));
+				OutIndices[c] = GetIndex(OutCorners[c].X, OutCorners[c].Y, OutCorners[c].Z);
+			}
+		}
+	};
+
+	// CellNum, LOD Step이 컴파일 시간에 정해진 격자, Density Index와 Cell 꼭짓점 Offset이 모두 상수
+	template <int32 InCellNum, int32 InStep>
+	struct TFixedLattice
+	{
+		static_assert(InCellNum % InStep == 0, "Fixed lattice requires CellNum divisible by Step");
 
-				int baseIndex = ChunkMeshData.Vertices.Num();
-				ChunkMeshData.Vertices.Append(CellMeshData.Vertices);
+		static constexpr int32 CellNum = InCellNum;
+		static constexpr int32 Step = InStep;
+		static constexpr int32 Apron = 1;
+		static constexpr int32 LatticeNum = CellNum / Step;
+		static constexpr int32 LatticeDim = LatticeNum + 1;
+		static constexpr int32 DensityDim = CellNum + 1 + 2 * Apron;
+		static constexpr int32 StrideX = Step;
+		static constexpr int32 StrideY = Step * DensityDim;
+		static constexpr int32 StrideZ = Step * DensityDim * DensityDim;
+
+		explicit TFixedLattice(const FChunkSettingInfo& Info)
+		{
+			check(Info.CellNum == CellNum && Info.Apron == Apron && FMath::Max(Info.LODLevel, 1) == Step
+				&& Info.DensityLayout == EVoxelDensityLayout::Linear);
+		}
 
-				for (int triIdx : CellMeshData.Triangles)
-					ChunkMeshData.Triangles.Add(baseIndex + triIdx);
+		static constexpr int32 LatticeToCorner(int32 Lattice) { return Lattice * Step; }
+		static constexpr int32 GetIndex(int32 X, int32 Y, int32 Z)
+		{
+			return (X + Apron) + (Y + Apron) * DensityDim + (Z + Apron) * DensityDim * DensityDim;
+		}
+
+		// MarchingCubeCompactTable::CornerOffsets 순서
+		static constexpr int32 CornerIndexOffsets[8] = {
+			0, StrideZ, StrideX + StrideZ, StrideX,
+			StrideY, StrideY + StrideZ, StrideX + StrideY + StrideZ, StrideX + StrideY
+		};
+
+		static void GetCellCorners(int32 i, int32 j, int32 k, FIntVector (&OutCorners)[8], int32 (&OutIndices)[8])
+		{
+			const int32 BaseIndex = GetIndex(i * Step, j * Step, k * Step);
+			for (int32 c = 0; c < 8; ++c)
+			{
+				const uint8* Offset = MarchingCubeCompactTable::CornerOffsets[c];
+				OutCorners[c] = FIntVector((i + Offset[0]) * Step, (j + Offset[1]) * Step, (k + Offset[2]) * Step);
+				OutIndices[c] = BaseIndex + CornerIndexOffsets[c];
 			}
 		}
-	}
+	};
+}
 
+FVoxelData MarchingCubeMeshGenerator::GenerateChunkMesh(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData)
+{
+	FVoxelData ChunkMeshData;
+	GenerateChunkMesh(Info, VertexDensityData, ChunkMeshData);
 	return ChunkMeshData;
 }
 
-FVoxelData MarchingCubeMeshGenerator::GenerateCellMesh(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData,
-				const FIntVector& CellIndex, const FIntVector& Step)
+void MarchingCubeMeshGenerator::GenerateChunkMesh(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData, FVoxelData& OutMeshData,
+	const FVoxelBrickMinMax* BrickMinMax)
 {
-	FVoxelData CellMeshData;
-	FIntVector CellCornerIndex[8]; // Chunk를 기준으로 Cell의 Index 값들
-	FVector CellCornerPos[8]; // Cell의 중심을 원점으로 하는 Cell 꼭짓점 좌표들
-	float CellCornerDensity[8];
-	const int ChunkSize = Info.CellSize * Info.CellNum;
+	VOXEL_SCOPE_STAGE(Marching);
+
+	// 자주 쓰는 Chunk 크기와 LOD Step 조합은 상수 격자로 특수화된 경로 사용 (Linear 배치만)
+	if (Info.Apron == TFixedLattice<16, 1>::Apron && Info.DensityLayout == EVoxelDensityLayout::Linear)
+	{
+		switch (Info.CellNum)
+		{
+		case 16: if (GenerateFixedMesh<16>(Info, VertexDensityData, OutMeshData, BrickMinMax)) return; break;
+		case 32: if (GenerateFixedMesh<32>(Info, VertexDensityData, OutMeshData, BrickMinMax)) return; break;
+		case 64: if (GenerateFixedMesh<64>(Info, VertexDensityData, OutMeshData, BrickMinMax)) return; break;
+		default: break;
+		}
+	}
+
+	GenerateLatticeMesh(FRuntimeLattice(Info), Info, VertexDensityData, OutMeshData, BrickMinMax);
+}
 
-	// Cell의 앞/좌/위 index값을 기준으로 나머지 정육면체 cell의 index 값들을 계산하는 함수
-	SetCellCornerIndex(CellIndex, CellCornerIndex, Step);
+void MarchingCubeMeshGenerator::GenerateChunkMeshGeneric(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData, FVoxelData& OutMeshData,
+	const FVoxelBrickMinMax* BrickMinMax)
+{
+	VOXEL_SCOPE_STAGE(Marching);
+	GenerateLatticeMesh(FRuntimeLattice(Info), Info, VertexDensityData, OutMeshData, BrickMinMax);
+}
 
-	// 정육면체 Cell의 8개 Index 값으로, Cell의 중심을 원점으로 하는 꼭짓점 좌표 8개와, Density 값을 배열에 저장
-	for (int i = 0; i < 8; i += 1)
+template <int32 FixedCellNum>
+bool MarchingCubeMeshGenerator::GenerateFixedMesh(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData, FVoxelData& OutMeshData,
+	const FVoxelBrickMinMax* BrickMinMax)
+{
+	switch (FMath::Max(Info.LODLevel, 1))
 	{
-		CellCornerDensity[i] = VertexDensityData[VoxelHelper::GetIndex(
-			CellCornerIndex[i].X, CellCornerIndex[i].Y, CellCornerIndex[i].Z, Info.CellNum)].Density;
-
-		const FVector CornerIndexVector(
-						static_cast<float>(CellCornerIndex[i].X),
-						static_cast<float>(CellCornerIndex[i].Y),
-						static_cast<float>(CellCornerIndex[i].Z));
-		CellCornerPos[i] = CornerIndexVector * Info.CellSize - FVector(ChunkSize) * 0.5f;
+	case 1: GenerateLatticeMesh(TFixedLattice<FixedCellNum, 1>(Info), Info, VertexDensityData, OutMeshData, BrickMinMax); return true;
+	case 2: GenerateLatticeMesh(TFixedLattice<FixedCellNum, 2>(Info), Info, VertexDensityData, OutMeshData, BrickMinMax); return true;
+	case 4: GenerateLatticeMesh(TFixedLattice<FixedCellNum, 4>(Info), Info, VertexDensityData, OutMeshData, BrickMinMax); return true;
+	case 8: GenerateLatticeMesh(TFixedLattice<FixedCellNum, 8>(Info), Info, VertexDensityData, OutMeshData, BrickMinMax); return true;
+	default: return false;
 	}
+}
+
+template <typename LatticeType>
+void MarchingCubeMeshGenerator::GenerateLatticeMesh(const LatticeType& Lattice, const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData,
+	FVoxelData& OutMeshData, const FVoxelBrickMinMax* BrickMinMax)
+{
+	FVoxelData& ChunkMeshData = OutMeshData;
+	ChunkMeshData.Vertices.Reset();
+	ChunkMeshData.Normals.Reset();
+	ChunkMeshData.Colors.Reset();
+	ChunkMeshData.Triangles.Reset();
+
+	const int32 LatticeNum = Lattice.LatticeNum;
+	const int32 LatticeDim = Lattice.LatticeDim;
+	const int32 SlabSize = LatticeDim * LatticeDim * 3;
+	const int ChunkSize = Info.CellSize * Info.CellNum;
+	const FVector ChunkHalfExtent(ChunkSize * 0.5f);
 
-	// Marching Cube Algorithm으로 Vertex/Triangle 계산 후 저장
-	int cubeIndex = 0;
-	for (int i = 0; i < 8; i++)
+	// 부호가 바뀌는 Brick이 하나도 없으면 표면이 없음
+	const bool bUseBricks = BrickMinMax && BrickMinMax->IsValid();
+	if (bUseBricks)
 	{
-		if (CellCornerDensity[i] < 0.0f)
-			cubeIndex |= (1 << i);
+		bool bAnySignChange = false;
+		for (int32 BrickIndex = 0; BrickIndex < BrickMinMax->Min.Num() && !bAnySignChange; ++BrickIndex)
+		{
+			bAnySignChange = BrickMinMax->HasSignChange(BrickIndex);
+		}
+		if (!bAnySignChange)
+			return;
 	}
 
-	if (MarchingCubeLooupTable::EdgeTable[cubeIndex] == 0)
-		return CellMeshData;
+	FEdgeCacheScratch& Scratch = GetEdgeCacheScratch();
+
+	// 격자 꼭짓점의 부호(Density < 0)를 X 방향 Row마다 64bit Mask로 압축, Row가 64보다 길면 여러 Word 사용
+	const int32 MaskWords = FMath::DivideAndRoundUp(LatticeDim, 64);
+	const int32 LastWordBits = LatticeDim - (MaskWords - 1) * 64;
+	const uint64 LastWordMask = LastWordBits == 64 ? ~0ull : (1ull << LastWordBits) - 1;
 
-	FVector VertexList[12];
-	for (int e = 0; e < 12; ++e)
+	TArray<uint64>& SignMasks = Scratch.SignMasks;
+	SignMasks.SetNumUninitialized(LatticeDim * LatticeDim * MaskWords, EAllowShrinking::No);
+	FMemory::Memzero(SignMasks.GetData(), SignMasks.Num() * sizeof(uint64));
+
+	bool bAnyNegative = false;
+	bool bAllNegative = true;
+	for (int32 k = 0; k < LatticeDim; ++k)
 	{
-		if (MarchingCubeLooupTable::EdgeTable[cubeIndex] & (1 << e))
+		const int32 Z = Lattice.LatticeToCorner(k);
+		for (int32 j = 0; j < LatticeDim; ++j)
 		{
-			int c0 = MarchingCubeLooupTable::EdgeVertexIndices[e][0];
-			int c1 = MarchingCubeLooupTable::EdgeVertexIndices[e][1];
-			VertexList[e] = InterpolateVertex(
-				CellCornerPos[c0], CellCornerPos[c1],
-				CellCornerDensity[c0], CellCornerDensity[c1]);
+			const int32 Y = Lattice.LatticeToCorner(j);
+			uint64* Row = &SignMasks[(k * LatticeDim + j) * MaskWords];
+			const int32 BrickRow = bUseBricks ? BrickMinMax->GetBrickIndex(0, BrickMinMax->CornerToBrick(Y), BrickMinMax->CornerToBrick(Z)) : 0;
+
+			for (int32 i = 0; i < LatticeDim; ++i)
+			{
+				const int32 X = Lattice.LatticeToCorner(i);
+				bool bNegative;
+
+				// 부호가 한쪽뿐인 Brick의 꼭짓점은 Density를 읽지 않음
+				const int32 BrickIndex = bUseBricks ? BrickRow + BrickMinMax->CornerToBrick(X) : INDEX_NONE;
+				if (BrickIndex != INDEX_NONE && !BrickMinMax->HasSignChange(BrickIndex))
+				{
+					bNegative = BrickMinMax->IsAllNegative(BrickIndex);
+				}
+				else
+				{
+					bNegative = VertexDensityData[Lattice.GetIndex(X, Y, Z)].Density < 0.0f;
+				}
+
+				if (bNegative)
+				{
+					Row[i >> 6] |= 1ull << (i & 63);
+				}
+			}
+
+			for (int32 w = 0; w < MaskWords; ++w)
+			{
+				bAnyNegative |= Row[w] != 0;
+				bAllNegative &= Row[w] == (w == MaskWords - 1 ? LastWordMask : ~0ull);
+			}
 		}
 	}
 
-	for (int i = 0; MarchingCubeLooupTable::TriTable[cubeIndex][i] != -1; i += 3)
+	// 표면이 지나지 않는 Chunk는 Cell 순회 없이 종료
+	if (!bAnyNegative || bAllNegative)
+		return;
+
+	// 공유 Edge의 정점은 한 번만 만들고 Index로 재사용 (Lower 꼭짓점 + Axis 기준이라 인접 Cell에서도 같은 값)
+	Scratch.Slabs[0].Init(INDEX_NONE, SlabSize);
+	Scratch.Slabs[1].Init(INDEX_NONE, SlabSize);
+
+	auto MeshCell = [&](int32 i, int32 j, int32 k, int32* BottomSlab, int32* TopSlab)
+	{
+		FIntVector CellCornerIndex[8];
+		int32 CellCornerDensityIndex[8];
+		float CellCornerDensity[8];
+		int cubeIndex = 0;
+
+		Lattice.GetCellCorners(i, j, k, CellCornerIndex, CellCornerDensityIndex);
+		for (int32 c = 0; c < 8; ++c)
+		{
+			CellCornerDensity[c] = VertexDensityData[CellCornerDensityIndex[c]].Density;
+			if (CellCornerDensity[c] < 0.0f)
+				cubeIndex |= (1 << c);
+		}
+
+		const FMarchingCubeCompactCase& Case = MarchingCubeCompactTable::Table.Cases[cubeIndex];
+		if (Case.EdgeCount == 0)
+			return;
+
+		int32 VertexIds[12];
+		for (int32 n = 0; n < Case.EdgeCount; ++n)
+		{
+			const uint8 Edge = Case.Edges[n];
+			const uint8 C0 = MarchingCubeCompactTable::EdgeCorners[Edge][0];
+			const uint8 C1 = MarchingCubeCompactTable::EdgeCorners[Edge][1];
+			const uint8* BaseOffset = MarchingCubeCompactTable::CornerOffsets[C0];
+
+			int32* Slab = BaseOffset[2] == 0 ? BottomSlab : TopSlab;
+			int32& CachedId = Slab[((j + BaseOffset[1]) * LatticeDim + (i + BaseOffset[0])) * 3 + MarchingCubeCompactTable::EdgeAxis[Edge]];
+
+			if (CachedId == INDEX_NONE)
+			{
+				const float t = GetInterpolationFactor(CellCornerDensity[C0], CellCornerDensity[C1]);
+				const FVector P0 = FVector(CellCornerIndex[C0]) * Info.CellSize - ChunkHalfExtent;
+				const FVector P1 = FVector(CellCornerIndex[C1]) * Info.CellSize - ChunkHalfExtent;
+
+				// Density는 내부로 갈수록 커지므로 바깥 방향 Normal은 -Gradient
+				const FVector G0 = ComputeCornerGradient(Lattice, Info, VertexDensityData, CellCornerIndex[C0]);
+				const FVector G1 = ComputeCornerGradient(Lattice, Info, VertexDensityData, CellCornerIndex[C1]);
+
+				CachedId = ChunkMeshData.Vertices.Add(FMath::Lerp(P0, P1, t));
+				ChunkMeshData.Normals.Add(-FMath::Lerp(G0, G1, t).GetSafeNormal());
+			}
+			VertexIds[n] = CachedId;
+		}
+
+		for (int32 n = 0; n < Case.TriangleCount * 3; ++n)
+		{
+			ChunkMeshData.Triangles.Add(VertexIds[Case.Triangles[n]]);
+		}
+	};
+
+	for (int32 k = 0; k < LatticeNum; ++k)
 	{
-		int idx0 = MarchingCubeLooupTable::TriTable[cubeIndex][i];
-		int idx1 = MarchingCubeLooupTable::TriTable[cubeIndex][i + 1];
-		int idx2 = MarchingCubeLooupTable::TriTable[cubeIndex][i + 2];
-
-		int vertIndex = CellMeshData.Vertices.Num();
-		CellMeshData.Vertices.Add(VertexList[idx0]);
-		CellMeshData.Vertices.Add(VertexList[idx1]);
-		CellMeshData.Vertices.Add(VertexList[idx2]);
-
-		CellMeshData.Triangles.Add(vertIndex + 2);
-		CellMeshData.Triangles.Add(vertIndex + 1);
-		CellMeshData.Triangles.Add(vertIndex);
+		// Bottom : 현재 층의 Z Edge와 아래면 X/Y Edge, Top : 윗면 X/Y Edge
+		int32* BottomSlab = Scratch.Slabs[k & 1].GetData();
+		int32* TopSlab = Scratch.Slabs[(k + 1) & 1].GetData();
+		if (k > 0)
+		{
+			FMemory::Memset(TopSlab, 0xFF, SlabSize * sizeof(int32));
+		}
+
+		for (int32 j = 0; j < LatticeNum; ++j)
+		{
+			// Cell i의 꼭짓점 4개 Row의 i, i + 1 Bit 중 음수가 하나 이상이고 전부 음수는 아니면 표면이 지나는 Cell
+			const uint64* R00 = &SignMasks[(k * LatticeDim + j) * MaskWords];
+			const uint64* R10 = R00 + MaskWords;
+			const uint64* R01 = R00 + LatticeDim * MaskWords;
+			const uint64* R11 = R01 + MaskWords;
+
+			for (int32 w = 0; w < MaskWords; ++w)
+			{
+				const bool bHasNext = w + 1 < MaskWords;
+				const uint64 Or = R00[w] | R10[w] | R01[w] | R11[w];
+				const uint64 And = R00[w] & R10[w] & R01[w] & R11[w];
+				const uint64 NextOr = bHasNext ? (R00[w + 1] | R10[w + 1] | R01[w + 1] | R11[w + 1]) : 0;
+				const uint64 NextAnd = bHasNext ? (R00[w + 1] & R10[w + 1] & R01[w + 1] & R11[w + 1]) : 0;
+
+				const uint64 OrShifted = (Or >> 1) | (NextOr << 63);
+				const uint64 AndShifted = (And >> 1) | (NextAnd << 63);
+				uint64 ActiveCells = (Or | OrShifted) & ~(And & AndShifted);
+
+				// Cell은 LatticeNum개이므로 마지막 꼭짓점 Bit는 제외
+				const int32 ValidCells = LatticeNum - w * 64;
+				if (ValidCells < 64)
+				{
+					ActiveCells &= (1ull << ValidCells) - 1;
+				}
+
+				while (ActiveCells != 0)
+				{
+					const int32 i = w * 64 + FMath::CountTrailingZeros64(ActiveCells);
+					ActiveCells &= ActiveCells - 1;
+					MeshCell(i, j, k, BottomSlab, TopSlab);
+				}
+			}
+		}
 	}
-	
-	return CellMeshData;
 }
 
-FVector MarchingCubeMeshGenerator::InterpolateVertex(const FVector& p1, const FVector& p2, float valp1, float valp2)
+float MarchingCubeMeshGenerator::GetInterpolationFactor(float valp1, float valp2)
 {
-	float t = (0.0f - valp1) / (valp2 - valp1);
-	return FMath::Lerp(p1, p2, t);
+	return (0.0f - valp1) / (valp2 - valp1);
 }
 
-void MarchingCubeMeshGenerator::SetCellCornerIndex(const FIntVector& CellIndex, FIntVector* V, const FIntVector& Step)
+template <typename LatticeType>
+FVector MarchingCubeMeshGenerator::ComputeCornerGradient(const LatticeType& Lattice, const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData,
+				const FIntVector& Corner)
 {
+	// 인접 꼭짓점 Density의 중심 차분, 경계 꼭짓점은 Apron 값을 사용
+	auto Sample = [&](int32 X, int32 Y, int32 Z) -> float
+	{
+		return VertexDensityData[Lattice.GetIndex(X, Y, Z)].Density;
+	};
 
-/*
-		 Z+  (Up)
-		 ↑
-		 │        (2)──────(6)
-		 │       /│        /│
-		 │    (1)──────(5)  │
-		 │     │ │      │   │
-		 │     │(3)-----│--/ (7)
-		 │     │/       │ /
-		 │   (0)──────(4) ────→ X+ (Forward)
-		 │
-		 └─────────────────→ Y+ (Right)
-*/
-
-	const int32 NextX = CellIndex.X + Step.X;
-	const int32 NextY = CellIndex.Y + Step.Y;
-	const int32 NextZ = CellIndex.Z + Step.Z;
-
-	V[4].X = V[5].X = V[0].X = V[1].X = CellIndex.X;
-	V[7].X = V[6].X = V[3].X = V[2].X = NextX;
-	
-	V[0].Y = V[1].Y = V[2].Y = V[3].Y = CellIndex.Y;
-	V[4].Y = V[5].Y = V[6].Y = V[7].Y = NextY;
-
-	V[0].Z = V[3].Z = V[4].Z = V[7].Z = CellIndex.Z;
-	V[1].Z = V[2].Z = V[5].Z = V[6].Z = NextZ;
+	const float InvDoubleCellSize = 0.5f / Info.CellSize;
+	return FVector(
+		Sample(Corner.X + 1, Corner.Y, Corner.Z) - Sample(Corner.X - 1, Corner.Y, Corner.Z),
+		Sample(Corner.X, Corner.Y + 1, Corner.Z) - Sample(Corner.X, Corner.Y - 1, Corner.Z),
+		Sample(Corner.X, Corner.Y, Corner.Z + 1) - Sample(Corner.X, Corner.Y, Corner.Z - 1)) * InvDoubleCellSize;
 }
@@ -5,12 +5,27 @@ class MarchingCubeMeshGenerator
 {
 public:
 	static FVoxelData GenerateChunkMesh(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData);
+	// OutMeshData의 기존 할당 용량을 재사용해서 결과를 채움, 인접 Cell이 공유하는 Edge의 정점은 하나로 합쳐서 출력
+	// BrickMinMax가 있으면 부호가 바뀌지 않는 Brick은 Density를 읽지 않고 건너뜀
+	static void GenerateChunkMesh(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData, FVoxelData& OutMeshData,
+		const FVoxelBrickMinMax* BrickMinMax = nullptr);
+	// CellNum 16/32/64, LOD Step 1/2/4/8 특수화 없이 항상 일반 경로로 생성 (특수화 경로 검증용)
+	static void GenerateChunkMeshGeneric(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData, FVoxelData& OutMeshData,
+		const FVoxelBrickMinMax* BrickMinMax = nullptr);
 
 private:
-	static FVoxelData GenerateCellMesh(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData,
-				const FIntVector& CellIndex, const FIntVector& Step);
+	// 지원하지 않는 LOD Step이면 false
+	template <int32 FixedCellNum>
+	static bool GenerateFixedMesh(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData, FVoxelData& OutMeshData,
+		const FVoxelBrickMinMax* BrickMinMax);
 
-	static FVector InterpolateVertex(const FVector& p1, const FVector& p2, float valp1, float valp2);
+	template <typename LatticeType>
+	static void GenerateLatticeMesh(const LatticeType& Lattice, const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData,
+		FVoxelData& OutMeshData, const FVoxelBrickMinMax* BrickMinMax);
 
-	static void SetCellCornerIndex(const FIntVector& CellIndex, FIntVector* V, const FIntVector& Step);
+	static float GetInterpolationFactor(float valp1, float valp2);
+
+	template <typename LatticeType>
+	static FVector ComputeCornerGradient(const LatticeType& Lattice, const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData,
+				const FIntVector& Corner);
 };
@@ -0,0 +1,147 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "MarchingCubeMeshGenerator.h"
+#include "Planet/Voxel/Benchmark/VoxelTestHelper.h"
+#include "Planet/Voxel/etc/VoxelHelper.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMarchingCubeEmptyFieldsTest, "Eclipser.Voxel.MarchingCube.EmptyFields", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMarchingCubeEmptyFieldsTest::RunTest(const FString& Parameters)
+{
+	// 전부 Solid이거나 전부 빈 공간이면 표면이 없음
+	const FChunkSettingInfo Info = VoxelTestHelper::MakeTestInfo(8, 1);
+	TArray<FVertexDensity> DensityData;
+
+	VoxelTestHelper::FillDensity(Info, [](const FVector&) { return 1.0f; }, DensityData);
+	FVoxelData MeshData = MarchingCubeMeshGenerator::GenerateChunkMesh(Info, DensityData);
+	AddErrorIfFalse(MeshData.Triangles.Num() == 0, FString::Printf(TEXT("Solid field produced %d indices"), MeshData.Triangles.Num()));
+
+	VoxelTestHelper::FillDensity(Info, [](const FVector&) { return -1.0f; }, DensityData);
+	MeshData = MarchingCubeMeshGenerator::GenerateChunkMesh(Info, DensityData);
+	AddErrorIfFalse(MeshData.Triangles.Num() == 0, FString::Printf(TEXT("Empty field produced %d indices"), MeshData.Triangles.Num()));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMarchingCubePlaneCountsTest, "Eclipser.Voxel.MarchingCube.PlaneCounts", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMarchingCubePlaneCountsTest::RunTest(const FString& Parameters)
+{
+	// 수평면은 Cell마다 삼각형 2개, LOD Step으로 나누어 떨어지지 않으면 마지막 Cell은 남은 크기만큼 사용
+	struct FPlaneCase
+	{
+		int32 CellNum;
+		int32 LODLevel;
+	};
+	const FPlaneCase Cases[] = { {16, 1}, {16, 2}, {16, 4}, {10, 4}, {32, 8} };
+
+	for (const FPlaneCase& Case : Cases)
+	{
+		const FChunkSettingInfo Info = VoxelTestHelper::MakeTestInfo(Case.CellNum, Case.LODLevel);
+		const float PlaneHeight = Case.CellNum * 0.5f - 0.37f;
+
+		TArray<FVertexDensity> DensityData;
+		VoxelTestHelper::FillDensity(Info, [PlaneHeight](const FVector& CellPos) { return PlaneHeight - CellPos.Z; }, DensityData);
+
+		const FVoxelData MeshData = MarchingCubeMeshGenerator::GenerateChunkMesh(Info, DensityData);
+		const int32 CellsPerAxis = FMath::DivideAndRoundUp(Case.CellNum, Case.LODLevel);
+		const int32 ExpectedTriangles = CellsPerAxis * CellsPerAxis * 2;
+		const FString CaseName = FString::Printf(TEXT("CellNum=%d LOD=%d"), Case.CellNum, Case.LODLevel);
+
+		AddErrorIfFalse(MeshData.Triangles.Num() == ExpectedTriangles * 3,
+			FString::Printf(TEXT("%s: expected %d triangles, got %d"), *CaseName, ExpectedTriangles, MeshData.Triangles.Num() / 3));
+		// 공유 Edge 정점은 합쳐지므로 평면의 정점 수는 격자 꼭짓점 수와 같음
+		const int32 ExpectedVertices = (CellsPerAxis + 1) * (CellsPerAxis + 1);
+		AddErrorIfFalse(MeshData.Vertices.Num() == ExpectedVertices,
+			FString::Printf(TEXT("%s: expected %d welded vertices, got %d"), *CaseName, ExpectedVertices, MeshData.Vertices.Num()));
+		AddErrorIfFalse(MeshData.Normals.Num() == MeshData.Vertices.Num(),
+			FString::Printf(TEXT("%s: %d normals for %d vertices"), *CaseName, MeshData.Normals.Num(), MeshData.Vertices.Num()));
+
+		const float ExpectedZ = PlaneHeight * Info.CellSize - Info.ChunkSize * 0.5f;
+		for (int32 i = 0; i < MeshData.Vertices.Num(); ++i)
+		{
+			if (!AddErrorIfFalse(FMath::IsNearlyEqual(MeshData.Vertices[i].Z, ExpectedZ, 0.01),
+				FString::Printf(TEXT("%s: vertex %d at Z=%f, expected %f"), *CaseName, i, MeshData.Vertices[i].Z, ExpectedZ)))
+				break;
+
+			// 아래쪽이 Solid이므로 바깥 방향은 +Z
+			if (MeshData.Normals.IsValidIndex(i) && !AddErrorIfFalse(MeshData.Normals[i].Z > 0.99,
+				FString::Printf(TEXT("%s: normal %d is %s"), *CaseName, i, *MeshData.Normals[i].ToString())))
+				break;
+		}
+
+		for (const int32 Index : MeshData.Triangles)
+		{
+			if (!AddErrorIfFalse(MeshData.Vertices.IsValidIndex(Index), FString::Printf(TEXT("%s: index %d out of range"), *CaseName, Index)))
+				break;
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMarchingCubeSphereWatertightTest, "Eclipser.Voxel.MarchingCube.SphereWatertight", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMarchingCubeSphereWatertightTest::RunTest(const FString& Parameters)
+{
+	// Chunk 안에 완전히 들어가는 구는 닫힌 Mesh여야 함
+	for (const int32 LODLevel : { 1, 2 })
+	{
+		const FChunkSettingInfo Info = VoxelTestHelper::MakeTestInfo(16, LODLevel);
+		const FVector Center(7.81f, 8.13f, 7.93f);
+		const float Radius = 5.37f;
+
+		TArray<FVertexDensity> DensityData;
+		VoxelTestHelper::FillDensity(Info, [&](const FVector& CellPos) { return Radius - FVector::Dist(CellPos, Center); }, DensityData);
+
+		const FVoxelData MeshData = MarchingCubeMeshGenerator::GenerateChunkMesh(Info, DensityData);
+		if (!AddErrorIfFalse(MeshData.Triangles.Num() > 0, FString::Printf(TEXT("LOD=%d: sphere produced no triangles"), LODLevel)))
+			continue;
+
+		FString Error;
+		AddErrorIfFalse(VoxelTestHelper::IsClosedManifold(MeshData, Error), FString::Printf(TEXT("LOD=%d: %s"), LODLevel, *Error));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMarchingCubeFixedSizeTest, "Eclipser.Voxel.MarchingCube.FixedSize", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMarchingCubeFixedSizeTest::RunTest(const FString& Parameters)
+{
+	// 특수화된 Chunk 크기 / LOD Step 조합은 일반 경로와 완전히 같은 Mesh를 만들어야 함
+	for (const int32 CellNum : { 16, 32, 64 })
+	{
+		for (const int32 LODLevel : { 1, 2, 4, 8 })
+		{
+			const FChunkSettingInfo Info = VoxelTestHelper::MakeTestInfo(CellNum, LODLevel);
+			const FVector Center(CellNum * 0.49f, CellNum * 0.52f, CellNum * 0.47f);
+			const float Radius = CellNum * 0.33f;
+
+			TArray<FVertexDensity> DensityData;
+			VoxelTestHelper::FillDensity(Info, [&](const FVector& CellPos)
+			{
+				return Radius - FVector::Dist(CellPos, Center) + FMath::Sin(CellPos.X * 0.7f) * 0.8f;
+			}, DensityData);
+
+			FVoxelBrickMinMax BrickMinMax;
+			VoxelHelper::BuildBrickMinMax(Info, DensityData, BrickMinMax);
+
+			FVoxelData Fixed;
+			FVoxelData Generic;
+			MarchingCubeMeshGenerator::GenerateChunkMesh(Info, DensityData, Fixed, &BrickMinMax);
+			MarchingCubeMeshGenerator::GenerateChunkMeshGeneric(Info, DensityData, Generic, &BrickMinMax);
+
+			AddErrorIfFalse(Fixed.Triangles.Num() > 0, FString::Printf(TEXT("CellNum=%d LOD=%d: no triangles"), CellNum, LODLevel));
+			AddErrorIfFalse(VoxelTestHelper::HashMesh(Fixed) == VoxelTestHelper::HashMesh(Generic),
+				FString::Printf(TEXT("CellNum=%d LOD=%d: fixed-size mesh differs from generic (%d / %d triangles)"),
+					CellNum, LODLevel, Fixed.Triangles.Num() / 3, Generic.Triangles.Num() / 3));
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,285 @@
+#include "SurfaceNetsMeshGenerator.h"
+#include "Planet/MarchingCube/MarchingCubeLookupTable.h"
+#include "Planet/Voxel/Defines/VoxelStats.h"
+#include "Planet/Voxel/etc/VoxelHelper.h"
+
+namespace
+{
+	// 격자 꼭짓점 Density와 Cell 정점 Index, Worker Thread마다 재사용
+	struct FSurfaceNetsScratch
+	{
+		TArray<float> CornerDensity;
+		TArray<int32> CellVertex;
+	};
+
+	FSurfaceNetsScratch& GetSurfaceNetsScratch()
+	{
+		static thread_local FSurfaceNetsScratch Scratch;
+		return Scratch;
+	}
+
+	// 평면이 한두 개뿐인 평평한 Cell에서 정점이 교차점 평균에서 멀어지지 않도록 당기는 가중치
+	constexpr double QefRegularization = 0.05;
+
+	// Dual Contouring 정점 위치용 최소자승 누적값, AᵀA는 대칭이라 6개만 저장
+	struct FQefAccumulator
+	{
+		double ATA[6] = {};
+		FVector3d ATb = FVector3d::ZeroVector;
+
+		void Add(const FVector3d& Point, const FVector3d& Normal)
+		{
+			ATA[0] += Normal.X * Normal.X; ATA[1] += Normal.X * Normal.Y; ATA[2] += Normal.X * Normal.Z;
+			ATA[3] += Normal.Y * Normal.Y; ATA[4] += Normal.Y * Normal.Z; ATA[5] += Normal.Z * Normal.Z;
+			ATb += Normal * FVector3d::DotProduct(Normal, Point);
+		}
+
+		// (AᵀA + λI) x = Aᵀb, 점은 교차점 평균 기준으로 넣으므로 해가 없는 방향은 평균(원점)으로 수렴
+		FVector3d Solve() const
+		{
+			const double M00 = ATA[0] + QefRegularization, M01 = ATA[1], M02 = ATA[2];
+			const double M11 = ATA[3] + QefRegularization, M12 = ATA[4];
+			const double M22 = ATA[5] + QefRegularization;
+
+			const double C00 = M11 * M22 - M12 * M12;
+			const double C01 = M02 * M12 - M01 * M22;
+			const double C02 = M01 * M12 - M02 * M11;
+			const double Det = M00 * C00 + M01 * C01 + M02 * C02;
+			if (FMath::Abs(Det) < UE_DOUBLE_SMALL_NUMBER)
+				return FVector3d::ZeroVector;
+
+			const double C11 = M00 * M22 - M02 * M02;
+			const double C12 = M01 * M02 - M00 * M12;
+			const double C22 = M00 * M11 - M01 * M01;
+			return FVector3d(
+				C00 * ATb.X + C01 * ATb.Y + C02 * ATb.Z,
+				C01 * ATb.X + C11 * ATb.Y + C12 * ATb.Z,
+				C02 * ATb.X + C12 * ATb.Y + C22 * ATb.Z) / Det;
+		}
+	};
+}
+
+void SurfaceNetsMeshGenerator::GenerateChunkMesh(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData, FVoxelData& OutMeshData,
+	bool bSharpFeatures, const FVoxelBrickMinMax* BrickMinMax)
+{
+	VOXEL_SCOPE_STAGE(Marching);
+
+	FVoxelData& ChunkMeshData = OutMeshData;
+	ChunkMeshData.Vertices.Reset();
+	ChunkMeshData.Normals.Reset();
+	ChunkMeshData.Colors.Reset();
+	ChunkMeshData.Triangles.Reset();
+
+	// 부호가 바뀌는 Brick이 하나도 없으면 표면이 없음
+	if (BrickMinMax && BrickMinMax->IsValid())
+	{
+		bool bAnySignChange = false;
+		for (int32 BrickIndex = 0; BrickIndex < BrickMinMax->Min.Num() && !bAnySignChange; ++BrickIndex)
+		{
+			bAnySignChange = BrickMinMax->HasSignChange(BrickIndex);
+		}
+		if (!bAnySignChange)
+			return;
+	}
+
+	// 격자 꼭짓점은 -1 ~ LatticeNum, Cell은 -1 ~ LatticeNum - 1 (-1은 음의 방향 이웃과 공유하는 경계 Cell)
+	const int32 Step = FMath::Max(Info.LODLevel, 1);
+	const int32 LatticeNum = FMath::DivideAndRoundUp(Info.CellNum, Step);
+	// 경계 Cell은 이웃 Chunk의 마지막 Cell과 같은 꼭짓점을 사용 (VoxelMesher가 Apron이 충분할 때만 호출)
+	const int32 NegativeCorner = (LatticeNum - 1) * Step - Info.CellNum;
+	check(-NegativeCorner < Info.Apron);
+	const int32 CornerDim = LatticeNum + 2;
+	const int32 CellDim = LatticeNum + 1;
+	const FVector ChunkHalfExtent(Info.CellSize * Info.CellNum * 0.5f);
+
+	auto LatticeToCorner = [&](int32 Lattice) -> int32
+	{
+		return Lattice < 0 ? NegativeCorner : FMath::Min(Lattice * Step, Info.CellNum);
+	};
+
+	auto CornerSlot = [&](int32 i, int32 j, int32 k) -> int32
+	{
+		return (i + 1) + ((j + 1) + (k + 1) * CornerDim) * CornerDim;
+	};
+
+	auto CellSlot = [&](int32 i, int32 j, int32 k) -> int32
+	{
+		return (i + 1) + ((j + 1) + (k + 1) * CellDim) * CellDim;
+	};
+
+	FSurfaceNetsScratch& Scratch = GetSurfaceNetsScratch();
+	TArray<float>& CornerDensity = Scratch.CornerDensity;
+	CornerDensity.SetNumUninitialized(CornerDim * CornerDim * CornerDim, EAllowShrinking::No);
+
+	bool bAnyNegative = false;
+	bool bAllNegative = true;
+	for (int32 k = -1; k <= LatticeNum; ++k)
+	{
+		const int32 Z = LatticeToCorner(k);
+		for (int32 j = -1; j <= LatticeNum; ++j)
+		{
+			const int32 Y = LatticeToCorner(j);
+			for (int32 i = -1; i <= LatticeNum; ++i)
+			{
+				const float Density = VertexDensityData[VoxelHelper::GetIndex(LatticeToCorner(i), Y, Z, Info)].Density;
+				CornerDensity[CornerSlot(i, j, k)] = Density;
+				bAnyNegative |= Density < 0.0f;
+				bAllNegative &= Density < 0.0f;
+			}
+		}
+	}
+
+	// 표면이 지나지 않는 Chunk는 Cell 순회 없이 종료
+	if (!bAnyNegative || bAllNegative)
+		return;
+
+	// Cell마다 표면 정점 하나
+	TArray<int32>& CellVertex = Scratch.CellVertex;
+	CellVertex.SetNumUninitialized(CellDim * CellDim * CellDim, EAllowShrinking::No);
+
+	for (int32 k = -1; k < LatticeNum; ++k)
+	{
+		for (int32 j = -1; j < LatticeNum; ++j)
+		{
+			for (int32 i = -1; i < LatticeNum; ++i)
+			{
+				int32& VertexId = CellVertex[CellSlot(i, j, k)];
+				VertexId = INDEX_NONE;
+
+				FIntVector CellCornerIndex[8];
+				float CellCornerDensity[8];
+				int32 CubeIndex = 0;
+				for (int32 c = 0; c < 8; ++c)
+				{
+					const uint8* Offset = MarchingCubeCompactTable::CornerOffsets[c];
+					CellCornerDensity[c] = CornerDensity[CornerSlot(i + Offset[0], j + Offset[1], k + Offset[2])];
+					if (CellCornerDensity[c] < 0.0f)
+						CubeIndex |= 1 << c;
+				}
+
+				if (CubeIndex == 0 || CubeIndex == 0xFF)
+					continue;
+
+				for (int32 c = 0; c < 8; ++c)
+				{
+					const uint8* Offset = MarchingCubeCompactTable::CornerOffsets[c];
+					CellCornerIndex[c] = FIntVector(LatticeToCorner(i + Offset[0]), LatticeToCorner(j + Offset[1]), LatticeToCorner(k + Offset[2]));
+				}
+
+				FVector Crossings[12];
+				FVector CrossingGradients[12];
+				int32 CrossingNum = 0;
+				FVector MassPoint = FVector::ZeroVector;
+				FVector GradientSum = FVector::ZeroVector;
+
+				for (int32 Edge = 0; Edge < 12; ++Edge)
+				{
+					const uint8 C0 = MarchingCubeCompactTable::EdgeCorners[Edge][0];
+					const uint8 C1 = MarchingCubeCompactTable::EdgeCorners[Edge][1];
+					if (((CubeIndex >> C0) & 1) == ((CubeIndex >> C1) & 1))
+						continue;
+
+					const float t = (0.0f - CellCornerDensity[C0]) / (CellCornerDensity[C1] - CellCornerDensity[C0]);
+					const FVector P0 = FVector(CellCornerIndex[C0]) * Info.CellSize - ChunkHalfExtent;
+					const FVector P1 = FVector(CellCornerIndex[C1]) * Info.CellSize - ChunkHalfExtent;
+					const FVector G0 = ComputeCornerGradient(Info, VertexDensityData, CellCornerIndex[C0]);
+					const FVector G1 = ComputeCornerGradient(Info, VertexDensityData, CellCornerIndex[C1]);
+
+					Crossings[CrossingNum] = FMath::Lerp(P0, P1, t);
+					CrossingGradients[CrossingNum] = FMath::Lerp(G0, G1, t);
+					MassPoint += Crossings[CrossingNum];
+					GradientSum += CrossingGradients[CrossingNum];
+					++CrossingNum;
+				}
+
+				MassPoint /= CrossingNum;
+				FVector Position = MassPoint;
+
+				if (bSharpFeatures)
+				{
+					FQefAccumulator Qef;
+					for (int32 n = 0; n < CrossingNum; ++n)
+					{
+						Qef.Add(FVector3d(Crossings[n] - MassPoint), FVector3d(CrossingGradients[n].GetSafeNormal()));
+					}
+
+					// 평면들이 Cell 밖에서 만나면 정점이 튀어나가므로 Cell 범위로 제한
+					const FVector CellMin = FVector(CellCornerIndex[0]) * Info.CellSize - ChunkHalfExtent;
+					const FVector CellMax = FVector(CellCornerIndex[6]) * Info.CellSize - ChunkHalfExtent;
+					Position = MassPoint + FVector(Qef.Solve());
+					Position = FVector(
+						FMath::Clamp(Position.X, CellMin.X, CellMax.X),
+						FMath::Clamp(Position.Y, CellMin.Y, CellMax.Y),
+						FMath::Clamp(Position.Z, CellMin.Z, CellMax.Z));
+				}
+
+				// Density는 내부로 갈수록 커지므로 바깥 방향 Normal은 -Gradient
+				VertexId = ChunkMeshData.Vertices.Add(Position);
+				ChunkMeshData.Normals.Add(-GradientSum.GetSafeNormal());
+			}
+		}
+	}
+
+	// 부호가 바뀌는 Edge마다 주변 Cell 4개의 정점으로 사각형 생성
+	// U, V는 Edge 축 기준 순환 순서라 (U-1,V-1) -> (U,V-1) -> (U,V) -> (U-1,V) 순서의 외적이 +Edge 축을 향함
+	// Marching Cube 출력과 같이 외적이 Solid(+Gradient) 쪽을 향하도록 감음
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const FIntVector AxisStep(Axis == 0, Axis == 1, Axis == 2);
+		const FIntVector UStep(Axis == 2, Axis == 0, Axis == 1);
+		const FIntVector VStep(Axis == 1, Axis == 2, Axis == 0);
+
+		for (int32 k = 0; k < LatticeNum; ++k)
+		{
+			for (int32 j = 0; j < LatticeNum; ++j)
+			{
+				for (int32 i = 0; i < LatticeNum; ++i)
+				{
+					const bool bLowerNegative = CornerDensity[CornerSlot(i, j, k)] < 0.0f;
+					const bool bUpperNegative = CornerDensity[CornerSlot(i + AxisStep.X, j + AxisStep.Y, k + AxisStep.Z)] < 0.0f;
+					if (bLowerNegative == bUpperNegative)
+						continue;
+
+					auto GetCellVertex = [&](const FIntVector& Offset) -> int32
+					{
+						return CellVertex[CellSlot(i + Offset.X, j + Offset.Y, k + Offset.Z)];
+					};
+
+					const int32 Q0 = GetCellVertex(FIntVector::ZeroValue - UStep - VStep);
+					const int32 Q1 = GetCellVertex(FIntVector::ZeroValue - VStep);
+					const int32 Q2 = GetCellVertex(FIntVector::ZeroValue);
+					const int32 Q3 = GetCellVertex(FIntVector::ZeroValue - UStep);
+					check(Q0 != INDEX_NONE && Q1 != INDEX_NONE && Q2 != INDEX_NONE && Q3 != INDEX_NONE);
+
+					if (bLowerNegative)
+					{
+						ChunkMeshData.Triangles.Append({ Q0, Q1, Q2, Q0, Q2, Q3 });
+					}
+					else
+					{
+						ChunkMeshData.Triangles.Append({ Q0, Q2, Q1, Q0, Q3, Q2 });
+					}
+				}
+			}
+		}
+	}
+}
+
+FVector SurfaceNetsMeshGenerator::ComputeCornerGradient(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData,
+				const FIntVector& Corner)
+{
+	// 인접 꼭짓점 Density의 차분, Apron 가장자리 꼭짓점은 안쪽 한 방향 차분 사용
+	const int32 MinCorner = -Info.Apron;
+	const int32 MaxCorner = Info.CellNum + Info.Apron;
+	auto Sample = [&](int32 X, int32 Y, int32 Z) -> float
+	{
+		return VertexDensityData[VoxelHelper::GetIndex(
+			FMath::Clamp(X, MinCorner, MaxCorner), FMath::Clamp(Y, MinCorner, MaxCorner), FMath::Clamp(Z, MinCorner, MaxCorner), Info)].Density;
+	};
+
+	const float InvDoubleCellSize = 0.5f / Info.CellSize;
+	return FVector(
+		Sample(Corner.X + 1, Corner.Y, Corner.Z) - Sample(Corner.X - 1, Corner.Y, Corner.Z),
+		Sample(Corner.X, Corner.Y + 1, Corner.Z) - Sample(Corner.X, Corner.Y - 1, Corner.Z),
+		Sample(Corner.X, Corner.Y, Corner.Z + 1) - Sample(Corner.X, Corner.Y, Corner.Z - 1)) * InvDoubleCellSize;
+}
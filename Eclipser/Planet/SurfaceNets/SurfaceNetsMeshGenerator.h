@@ -0,0 +1,22 @@
+#pragma once
+#include "Planet/Voxel/Defines/VoxelStructs.h"
+
+/*
+ * Surface Nets / Dual Contouring Mesher
+ * 표면이 지나는 Cell마다 정점 하나를 두고, 부호가 바뀌는 Edge마다 그 Edge를 공유하는 Cell 4개의 정점으로 사각형을 만듦
+ * Surface Nets는 Edge 교차점의 평균, Dual Contouring은 교차점 Normal 평면들의 QEF 최소점에 정점을 둬서 파낸 모서리를 유지
+ *
+ * Chunk는 최소 꼭짓점이 [0, LatticeNum) 범위인 Edge만 담당하고, 음의 방향 경계 Cell 정점은 Apron 꼭짓점으로 계산
+ * 경계 Cell은 이웃 Chunk의 마지막 Cell과 같은 크기이므로 Info.Apron이 VoxelMesher::GetRequiredApron 이상이어야 함
+ */
+class SurfaceNetsMeshGenerator
+{
+public:
+	// bSharpFeatures가 true면 Dual Contouring, false면 Surface Nets
+	static void GenerateChunkMesh(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData, FVoxelData& OutMeshData,
+		bool bSharpFeatures, const FVoxelBrickMinMax* BrickMinMax = nullptr);
+
+private:
+	static FVector ComputeCornerGradient(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData,
+				const FIntVector& Corner);
+};
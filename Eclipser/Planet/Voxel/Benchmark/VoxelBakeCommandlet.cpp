@@ -0,0 +1,102 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VoxelBakeCommandlet.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Planet/Voxel/Defines/VoxelStructs.h"
+#include "Planet/Voxel/etc/VoxelCookedPlanet.h"
+#include "Planet/Voxel/etc/VoxelMesher.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVoxelBake, Log, All);
+
+UVoxelBakeCommandlet::UVoxelBakeCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UVoxelBakeCommandlet::Main(const FString& Params)
+{
+	FChunkSettingInfo BaseInfo{ FIntVector::ZeroValue, 100, 32, 8 };
+	FParse::Value(*Params, TEXT("CellSize="), BaseInfo.CellSize);
+	FParse::Value(*Params, TEXT("CellNum="), BaseInfo.CellNum);
+	FParse::Value(*Params, TEXT("ChunkNum="), BaseInfo.ChunkNum);
+	FParse::Value(*Params, TEXT("Apron="), BaseInfo.Apron);
+	BaseInfo.Apron = FMath::Max(1, BaseInfo.Apron);
+
+	FString LayoutValue;
+	if (FParse::Value(*Params, TEXT("Layout="), LayoutValue))
+	{
+		const int64 Parsed = StaticEnum<EVoxelDensityLayout>()->GetValueByNameString(LayoutValue);
+		BaseInfo.DensityLayout = Parsed != INDEX_NONE ? static_cast<EVoxelDensityLayout>(Parsed) : BaseInfo.DensityLayout;
+	}
+
+	FString MesherValue;
+	if (FParse::Value(*Params, TEXT("Mesher="), MesherValue))
+	{
+		const int64 Parsed = StaticEnum<EVoxelMesherType>()->GetValueByNameString(MesherValue);
+		BaseInfo.MesherType = Parsed != INDEX_NONE ? static_cast<EVoxelMesherType>(Parsed) : BaseInfo.MesherType;
+	}
+
+	if (BaseInfo.CellSize <= 0 || BaseInfo.CellNum <= 0 || BaseInfo.ChunkNum <= 0)
+	{
+		UE_LOG(LogVoxelBake, Error, TEXT("Invalid planet settings CellSize=%d CellNum=%d ChunkNum=%d"), BaseInfo.CellSize, BaseInfo.CellNum, BaseInfo.ChunkNum);
+		return 1;
+	}
+
+	// "Level[:TriangleBudget],Level" 형식
+	FString LODValue = TEXT("1");
+	FParse::Value(*Params, TEXT("LODs="), LODValue, false);
+
+	TArray<FVoxelCookedPlanet::FBakeLOD> LODs;
+	TArray<FString> Entries;
+	LODValue.ParseIntoArray(Entries, TEXT(","));
+	for (const FString& Entry : Entries)
+	{
+		TArray<FString> Fields;
+		Entry.ParseIntoArray(Fields, TEXT(":"));
+		if (Fields.Num() == 0)
+			continue;
+
+		FVoxelCookedPlanet::FBakeLOD& LOD = LODs.AddDefaulted_GetRef();
+		LOD.LODLevel = FMath::Clamp(FCString::Atoi(*Fields[0]), 1, BaseInfo.CellNum);
+		LOD.TriangleBudget = Fields.Num() >= 2 ? FMath::Max(0, FCString::Atoi(*Fields[1])) : 0;
+	}
+
+	// Manager와 같은 규칙으로 Dual Mesher가 굽는 모든 LOD에서 Seam이 맞도록 Apron을 올림
+	for (const FVoxelCookedPlanet::FBakeLOD& LOD : LODs)
+	{
+		BaseInfo.Apron = FMath::Max(BaseInfo.Apron, VoxelMesher::GetRequiredApron(BaseInfo.MesherType, BaseInfo.CellNum, LOD.LODLevel));
+	}
+
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		OutputPath = FPaths::ProjectContentDir() / TEXT("VoxelCooked") / TEXT("Planet.vxp");
+	}
+	else if (FPaths::IsRelative(OutputPath))
+	{
+		OutputPath = FPaths::ProjectDir() / OutputPath;
+	}
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutputPath), true);
+
+	UE_LOG(LogVoxelBake, Display, TEXT("Baking CellSize=%d CellNum=%d ChunkNum=%d Apron=%d Layout=%s Mesher=%s, %d LODs"),
+		BaseInfo.CellSize, BaseInfo.CellNum, BaseInfo.ChunkNum, BaseInfo.Apron,
+		*StaticEnum<EVoxelDensityLayout>()->GetNameStringByValue(static_cast<int64>(BaseInfo.DensityLayout)),
+		*StaticEnum<EVoxelMesherType>()->GetNameStringByValue(static_cast<int64>(BaseInfo.MesherType)), LODs.Num());
+
+	const double StartTime = FPlatformTime::Seconds();
+	int64 FileSize = 0;
+	if (!FVoxelCookedPlanet::Bake(BaseInfo, LODs, OutputPath, FileSize))
+	{
+		UE_LOG(LogVoxelBake, Error, TEXT("Failed to write cooked planet %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogVoxelBake, Display, TEXT("Cooked planet written to %s (%.2f MB, %.2f s)"), *OutputPath,
+		FileSize / (1024.0 * 1024.0), FPlatformTime::Seconds() - StartTime);
+	return 0;
+}
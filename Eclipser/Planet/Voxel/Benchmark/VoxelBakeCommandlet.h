@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "VoxelBakeCommandlet.generated.h"
+
+/*
+ * Planet 전체의 Density와 LOD별 기본 Mesh를 미리 생성해서 FVoxelCookedPlanet 파일로 저장하는 Commandlet
+ *
+ * UnrealEditor-Cmd Eclipser.uproject -run=VoxelBake -nullrhi -unattended
+ *   -CellSize=100 -CellNum=32 -ChunkNum=8 -Apron=1 -Layout=Linear -Mesher=MarchingCubes
+ *   -LODs=1,2,4:2000,8:500 (Level[:TriangleBudget]) -Output=Content/VoxelCooked/Planet.vxp
+ *
+ * UVoxelManager의 CookedPlanetPath에 Content 기준 경로를 넣으면 같은 설정의 Chunk는 절차적 생성 대신 이 파일을 읽음
+ * 삼각형 예산은 Manager의 LODDistanceLevels / SimplifyMinLODLevel로 정해지는 값과 같아야 구운 Mesh를 사용
+ */
+UCLASS()
+class ECLIPSER_API UVoxelBakeCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UVoxelBakeCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,478 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VoxelBenchmarkCommandlet.h"
+
+#include "VoxelBenchmarkWorld.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Planet/Voxel/VoxelChunk.h"
+#include "Planet/Voxel/VoxelManager.h"
+#include "Planet/Voxel/Defines/VoxelStats.h"
+#include "Planet/Voxel/etc/VoxelBuildResultPool.h"
+#include "Planet/Voxel/etc/VoxelMesher.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVoxelBenchmark, Log, All);
+
+UVoxelBenchmarkCommandlet::UVoxelBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UVoxelBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString CellNumValue;
+	FString ChunkNumValue;
+	FString LODValue;
+	FString LayoutValue;
+	FString MesherValue;
+	FString OutputPath;
+	FParse::Value(*Params, TEXT("CellNum="), CellNumValue, false);
+	FParse::Value(*Params, TEXT("ChunkNum="), ChunkNumValue, false);
+	FParse::Value(*Params, TEXT("LOD="), LODValue, false);
+	FParse::Value(*Params, TEXT("Layout="), LayoutValue, false);
+	FParse::Value(*Params, TEXT("Mesher="), MesherValue, false);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	FScenario BaseScenario;
+	FParse::Value(*Params, TEXT("CellSize="), BaseScenario.CellSize);
+	FParse::Value(*Params, TEXT("Budget="), BaseScenario.MaxChunksPerFrame);
+	FParse::Value(*Params, TEXT("TimeBudgetMs="), BaseScenario.TimeBudgetMs);
+	FParse::Value(*Params, TEXT("SculptCount="), BaseScenario.SculptCount);
+	FParse::Value(*Params, TEXT("SculptRadius="), BaseScenario.SculptRadius);
+	FParse::Value(*Params, TEXT("MemoryBudgetMB="), BaseScenario.MemoryBudgetMB);
+	FParse::Value(*Params, TEXT("Seed="), BaseScenario.Seed);
+	FParse::Value(*Params, TEXT("MesherIterations="), BaseScenario.MesherIterations);
+	BaseScenario.bRenderFree = FParse::Param(*Params, TEXT("RenderFree"));
+	BaseScenario.LODLevels = ParseLODLevels(LODValue);
+
+	float TimeoutSeconds = 600.0f;
+	FParse::Value(*Params, TEXT("Timeout="), TimeoutSeconds);
+
+	// Replay는 기록 당시의 Planet 설정을 그대로 사용
+	FString ReplayPath;
+	if (FParse::Value(*Params, TEXT("Replay="), ReplayPath))
+	{
+		const TSharedRef<FVoxelDigRecording> Recording = MakeShared<FVoxelDigRecording>();
+		if (!Recording->LoadFromFile(ReplayPath))
+		{
+			UE_LOG(LogVoxelBenchmark, Error, TEXT("Failed to load dig recording %s"), *ReplayPath);
+			return 1;
+		}
+
+		BaseScenario.Replay = Recording;
+		BaseScenario.CellSize = Recording->CellSize;
+		CellNumValue = FString::FromInt(Recording->CellNum);
+		ChunkNumValue = FString::FromInt(Recording->ChunkNum);
+	}
+
+	if (OutputPath.IsEmpty())
+	{
+		OutputPath = FPaths::ProjectSavedDir() / TEXT("VoxelBenchmark") / (FDateTime::Now().ToString() + TEXT(".json"));
+	}
+
+	TArray<FScenarioResult> Results;
+	bool bAllCompleted = true;
+
+	for (const EVoxelMesherType MesherType : ParseEnumList(MesherValue, EVoxelMesherType::MarchingCubes))
+	for (const EVoxelDensityLayout Layout : ParseEnumList(LayoutValue, EVoxelDensityLayout::Linear))
+	for (const int32 CellNum : ParseIntList(CellNumValue, BaseScenario.CellNum))
+	{
+		for (const int32 ChunkNum : ParseIntList(ChunkNumValue, BaseScenario.ChunkNum))
+		{
+			FScenario Scenario = BaseScenario;
+			Scenario.CellNum = CellNum;
+			Scenario.ChunkNum = ChunkNum;
+			Scenario.DensityLayout = Layout;
+			Scenario.MesherType = MesherType;
+
+			UE_LOG(LogVoxelBenchmark, Display, TEXT("Running scenario CellSize=%d CellNum=%d ChunkNum=%d Layout=%s Mesher=%s"),
+				Scenario.CellSize, Scenario.CellNum, Scenario.ChunkNum, *GetEnumName(Scenario.DensityLayout), *GetEnumName(Scenario.MesherType));
+
+			FScenarioResult& Result = Results.Add_GetRef(RunScenario(Scenario, TimeoutSeconds));
+			bAllCompleted &= Result.bCompleted;
+
+			UE_LOG(LogVoxelBenchmark, Display, TEXT("  Build %.2f ms (%d frames, first visible %.2f ms), %llu chunks, %llu triangles, sculpt avg %.3f ms max %.3f ms"),
+				Result.BuildTimeMs, Result.BuildFrames, Result.FirstVisibleMs, Result.ChunksBuilt, Result.TrianglesBuilt,
+				Result.SculptsApplied > 0 ? Result.SculptTotalMs / Result.SculptsApplied : 0.0, Result.SculptMaxMs);
+			UE_LOG(LogVoxelBenchmark, Display, TEXT("  Voxel memory %.1f MB (budget %d MB)"),
+				Result.VoxelMemoryBytes / (1024.0 * 1024.0), Scenario.MemoryBudgetMB);
+
+			if (Result.bReplayed)
+			{
+				UE_LOG(LogVoxelBenchmark, Display, TEXT("  Replay %d sculpts, %d frames, frame avg %.2f ms p95 %.2f ms max %.2f ms"),
+					Result.ReplayStats.SculptCount, Result.ReplayStats.Frames, Result.ReplayStats.AvgFrameMs,
+					Result.ReplayStats.P95FrameMs, Result.ReplayStats.MaxFrameMs);
+			}
+
+			for (const FMesherLODResult& LOD : Result.MesherLODs)
+			{
+				UE_LOG(LogVoxelBenchmark, Display, TEXT("  Mesher LOD %d: %.4f ms, %d vertices, %d triangles"), LOD.LODLevel, LOD.AvgMs, LOD.Vertices, LOD.Triangles);
+			}
+		}
+	}
+
+	const bool bWritten = OutputPath.EndsWith(TEXT(".csv")) ? WriteCsv(OutputPath, Results) : WriteJson(OutputPath, Results);
+	if (!bWritten)
+	{
+		UE_LOG(LogVoxelBenchmark, Error, TEXT("Failed to write benchmark result to %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogVoxelBenchmark, Display, TEXT("Benchmark result written to %s"), *OutputPath);
+	return bAllCompleted ? 0 : 1;
+}
+
+UVoxelBenchmarkCommandlet::FScenarioResult UVoxelBenchmarkCommandlet::RunScenario(const FScenario& Scenario, float TimeoutSeconds)
+{
+	FScenarioResult Result;
+	Result.Scenario = Scenario;
+
+	FVoxelBenchmarkWorld BenchmarkWorld;
+	FVoxelPipelineCounters::Get().Reset();
+
+	UVoxelManager* Manager = BenchmarkWorld.SpawnPlanet([&Scenario](UVoxelManager& InManager)
+	{
+		InManager.CellSize = Scenario.CellSize;
+		InManager.CellNum = Scenario.CellNum;
+		InManager.ChunkNum = Scenario.ChunkNum;
+		InManager.DensityLayout = Scenario.DensityLayout;
+		InManager.MesherType = Scenario.MesherType;
+		InManager.SetLODDistanceLevels(Scenario.LODLevels);
+		InManager.SetChunkProcessingBudget(Scenario.MaxChunksPerFrame, Scenario.TimeBudgetMs);
+		InManager.SetMemoryBudgetMB(Scenario.MemoryBudgetMB);
+		// 이전 실행의 Cache가 결과에 섞이지 않도록 항상 생성
+		InManager.SetDiskCacheEnabled(false);
+
+		// Pawn이 없으므로 +Z 표면 근처를 기준으로 Residency 유지
+		InManager.SetRenderFree(Scenario.bRenderFree);
+		if (Scenario.bRenderFree)
+		{
+			const float VoxelSize = static_cast<float>(Scenario.CellSize) * Scenario.CellNum * Scenario.ChunkNum;
+			InManager.SetReferenceLocationOverride(FVector(0.0f, 0.0f, VoxelSize * 0.3f));
+		}
+	});
+
+	Result.bCompleted = BenchmarkWorld.TickUntil([Manager]() { return Manager->IsInitialBuildComplete(); }, TimeoutSeconds, Result.BuildFrames);
+	// Chunk Component는 Build 결과가 도착하면서 나눠서 생성됨
+	Result.ChunkCount = Manager->GetChunkCount();
+	Result.BuildTimeMs = Manager->GetInitialBuildTimeMs();
+	Result.FirstVisibleMs = Manager->GetFirstVisibleTimeMs();
+
+	// 같은 Seed면 같은 방향으로 Ray를 쏴서 같은 지점을 팜
+	if (Result.bCompleted && Scenario.SculptCount > 0)
+	{
+		FRandomStream Random(Scenario.Seed);
+		const float VoxelSize = static_cast<float>(Scenario.CellSize) * Scenario.CellNum * Scenario.ChunkNum;
+		const FVector Center = Manager->GetComponentLocation();
+
+		for (int32 i = 0; i < Scenario.SculptCount; ++i)
+		{
+			const FVector Direction = Random.GetUnitVector();
+			const FVector Start = Center + Direction * VoxelSize;
+
+			FVoxelRaycastHit Hit;
+			if (!Manager->Raycast(Start, Center, Hit))
+				continue;
+
+			const double SculptStart = FPlatformTime::Seconds();
+			Manager->Sculpt(Hit.ImpactPoint, Scenario.SculptRadius);
+			const double SculptMs = (FPlatformTime::Seconds() - SculptStart) * 1000.0;
+
+			Result.SculptTotalMs += SculptMs;
+			Result.SculptMaxMs = FMath::Max(Result.SculptMaxMs, SculptMs);
+			++Result.SculptsApplied;
+
+			BenchmarkWorld.Tick();
+		}
+	}
+
+	// Replay 시작 시 Pipeline 통계가 초기화되므로 아래 Stage 시간은 Replay 구간만 포함
+	if (Result.bCompleted && Scenario.Replay.IsValid())
+	{
+		Manager->StartDigReplay(Scenario.Replay.ToSharedRef());
+
+		int32 ReplayFrames = 0;
+		Result.bCompleted = BenchmarkWorld.TickUntil([Manager]() { return !Manager->IsReplayingDig(); }, TimeoutSeconds, ReplayFrames);
+		Manager->StopDigReplay();
+
+		Result.bReplayed = true;
+		Result.ReplayStats = Manager->GetLastDigReplayStats();
+	}
+
+	// 남은 Task가 Manager를 참조하지 않도록 모두 끝날 때까지 대기
+	int32 DrainFrames = 0;
+	BenchmarkWorld.TickUntil([Manager]() { return !Manager->HasPendingBuilds(); }, TimeoutSeconds, DrainFrames);
+
+	CollectStageTimings(Result);
+	Result.ChunksBuilt = FVoxelPipelineCounters::Get().GetChunksBuilt();
+	Result.TrianglesBuilt = FVoxelPipelineCounters::Get().GetTrianglesBuilt();
+	Result.PeakUsedPhysicalBytes = FPlatformMemory::GetStats().PeakUsedPhysical;
+	Result.VoxelMemoryBytes = Manager->GetMemoryBytes();
+	Result.ResultBuffersAllocated = Manager->GetResultPool().GetAllocatedCount();
+	Result.ResultBuffersReused = Manager->GetResultPool().GetReusedCount();
+
+	MeasureMesherLODs(Scenario, Result);
+
+	return Result;
+}
+
+void UVoxelBenchmarkCommandlet::MeasureMesherLODs(const FScenario& Scenario, FScenarioResult& Result)
+{
+	// 위에서부터 내려오며 표면이 지나는 첫 Chunk를 기준으로 사용
+	FChunkSettingInfo Info{ FIntVector::ZeroValue, Scenario.CellSize, Scenario.CellNum, Scenario.ChunkNum, 1, 1, Scenario.DensityLayout, Scenario.MesherType };
+	FChunkBuildResult BuildResult;
+	for (int32 z = Scenario.ChunkNum - 1; z >= 0; --z)
+	{
+		Info.ChunkIndex = FIntVector(Scenario.ChunkNum / 2, Scenario.ChunkNum / 2, z);
+		Info.Calculate();
+		UVoxelChunk::GenerateChunkData(Info, nullptr, nullptr, BuildResult);
+		if (BuildResult.MeshData.Triangles.Num() > 0)
+			break;
+	}
+
+	FVoxelData MeshData;
+	for (const int32 LODLevel : { 1, 2, 4, 8 })
+	{
+		// Apron이 부족하면 Dual Mesher가 Marching Cube로 대체되므로 이 LOD에 필요한 Apron으로 Density를 다시 생성
+		const int32 RequiredApron = VoxelMesher::GetRequiredApron(Info.MesherType, Info.CellNum, LODLevel);
+		if (RequiredApron > Info.Apron)
+		{
+			Info.Apron = RequiredApron;
+			UVoxelChunk::GenerateChunkData(Info, nullptr, nullptr, BuildResult);
+		}
+
+		FChunkSettingInfo LODInfo = Info;
+		LODInfo.LODLevel = LODLevel;
+
+		const int32 Iterations = FMath::Max(1, Scenario.MesherIterations);
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			VoxelMesher::GenerateChunkMesh(LODInfo, BuildResult.DensityData, MeshData, &BuildResult.BrickMinMax);
+		}
+
+		FMesherLODResult& LODResult = Result.MesherLODs.AddDefaulted_GetRef();
+		LODResult.LODLevel = LODLevel;
+		LODResult.AvgMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+		LODResult.Vertices = MeshData.Vertices.Num();
+		LODResult.Triangles = MeshData.Triangles.Num() / 3;
+	}
+}
+
+void UVoxelBenchmarkCommandlet::CollectStageTimings(FScenarioResult& Result)
+{
+	const FVoxelPipelineCounters& Counters = FVoxelPipelineCounters::Get();
+	for (int32 i = 0; i < static_cast<int32>(EVoxelPipelineStage::Num); ++i)
+	{
+		const EVoxelPipelineStage Stage = static_cast<EVoxelPipelineStage>(i);
+		Result.StageMs.Emplace(FVoxelPipelineCounters::GetStageName(Stage), Counters.GetStageMs(Stage));
+		Result.StageCalls.Emplace(FVoxelPipelineCounters::GetStageName(Stage), Counters.GetStageCalls(Stage));
+	}
+}
+
+TArray<FLODDistanceLevel> UVoxelBenchmarkCommandlet::ParseLODLevels(const FString& Value)
+{
+	// "Distance:Level[:TriangleBudget],Distance:Level" 형식
+	TArray<FLODDistanceLevel> Levels;
+	TArray<FString> Entries;
+	Value.ParseIntoArray(Entries, TEXT(","));
+
+	for (const FString& Entry : Entries)
+	{
+		TArray<FString> Fields;
+		Entry.ParseIntoArray(Fields, TEXT(":"));
+		if (Fields.Num() >= 2)
+		{
+			FLODDistanceLevel& LODLevel = Levels.AddDefaulted_GetRef();
+			LODLevel.DistanceThreshold = FCString::Atof(*Fields[0]);
+			LODLevel.LODLevel = FMath::Max(1, FCString::Atoi(*Fields[1]));
+			LODLevel.TriangleBudget = Fields.Num() >= 3 ? FMath::Max(0, FCString::Atoi(*Fields[2])) : 0;
+		}
+	}
+	return Levels;
+}
+
+TArray<int32> UVoxelBenchmarkCommandlet::ParseIntList(const FString& Value, int32 DefaultValue)
+{
+	TArray<int32> Values;
+	TArray<FString> Entries;
+	Value.ParseIntoArray(Entries, TEXT(","));
+
+	for (const FString& Entry : Entries)
+	{
+		const int32 Parsed = FCString::Atoi(*Entry);
+		if (Parsed > 0)
+		{
+			Values.Add(Parsed);
+		}
+	}
+
+	if (Values.Num() == 0)
+	{
+		Values.Add(DefaultValue);
+	}
+	return Values;
+}
+
+template <typename EnumType>
+TArray<EnumType> UVoxelBenchmarkCommandlet::ParseEnumList(const FString& Value, EnumType DefaultValue)
+{
+	TArray<EnumType> Values;
+	TArray<FString> Entries;
+	Value.ParseIntoArray(Entries, TEXT(","));
+
+	const UEnum* Enum = StaticEnum<EnumType>();
+	for (const FString& Entry : Entries)
+	{
+		const int64 Parsed = Enum->GetValueByNameString(Entry.TrimStartAndEnd());
+		if (Parsed != INDEX_NONE)
+		{
+			Values.AddUnique(static_cast<EnumType>(Parsed));
+		}
+		else
+		{
+			UE_LOG(LogVoxelBenchmark, Warning, TEXT("Unknown %s '%s' ignored"), *Enum->GetName(), *Entry);
+		}
+	}
+
+	if (Values.Num() == 0)
+	{
+		Values.Add(DefaultValue);
+	}
+	return Values;
+}
+
+template <typename EnumType>
+FString UVoxelBenchmarkCommandlet::GetEnumName(EnumType Value)
+{
+	return StaticEnum<EnumType>()->GetNameStringByValue(static_cast<int64>(Value));
+}
+
+bool UVoxelBenchmarkCommandlet::WriteJson(const FString& Path, const TArray<FScenarioResult>& Results)
+{
+	TArray<TSharedPtr<FJsonValue>> ScenarioValues;
+	for (const FScenarioResult& Result : Results)
+	{
+		const TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetNumberField(TEXT("CellSize"), Result.Scenario.CellSize);
+		Object->SetNumberField(TEXT("CellNum"), Result.Scenario.CellNum);
+		Object->SetNumberField(TEXT("ChunkNum"), Result.Scenario.ChunkNum);
+		Object->SetNumberField(TEXT("MaxChunksPerFrame"), Result.Scenario.MaxChunksPerFrame);
+		Object->SetStringField(TEXT("DensityLayout"), GetEnumName(Result.Scenario.DensityLayout));
+		Object->SetStringField(TEXT("Mesher"), GetEnumName(Result.Scenario.MesherType));
+		Object->SetBoolField(TEXT("RenderFree"), Result.Scenario.bRenderFree);
+		Object->SetBoolField(TEXT("Completed"), Result.bCompleted);
+		Object->SetNumberField(TEXT("ChunkCount"), Result.ChunkCount);
+		Object->SetNumberField(TEXT("BuildTimeMs"), Result.BuildTimeMs);
+		Object->SetNumberField(TEXT("BuildFrames"), Result.BuildFrames);
+		Object->SetNumberField(TEXT("FirstVisibleMs"), Result.FirstVisibleMs);
+		Object->SetNumberField(TEXT("ChunksBuilt"), Result.ChunksBuilt);
+		Object->SetNumberField(TEXT("TrianglesBuilt"), Result.TrianglesBuilt);
+
+		const double BuildSeconds = Result.BuildTimeMs / 1000.0;
+		Object->SetNumberField(TEXT("ChunksPerSecond"), BuildSeconds > 0.0 ? Result.ChunkCount / BuildSeconds : 0.0);
+		Object->SetNumberField(TEXT("TrianglesPerSecond"), BuildSeconds > 0.0 ? Result.TrianglesBuilt / BuildSeconds : 0.0);
+
+		Object->SetNumberField(TEXT("SculptsApplied"), Result.SculptsApplied);
+		Object->SetNumberField(TEXT("SculptAvgMs"), Result.SculptsApplied > 0 ? Result.SculptTotalMs / Result.SculptsApplied : 0.0);
+		Object->SetNumberField(TEXT("SculptMaxMs"), Result.SculptMaxMs);
+		if (Result.bReplayed)
+		{
+			Object->SetNumberField(TEXT("ReplaySculpts"), Result.ReplayStats.SculptCount);
+			Object->SetNumberField(TEXT("ReplayFrames"), Result.ReplayStats.Frames);
+			Object->SetNumberField(TEXT("ReplayAvgFrameMs"), Result.ReplayStats.AvgFrameMs);
+			Object->SetNumberField(TEXT("ReplayP95FrameMs"), Result.ReplayStats.P95FrameMs);
+			Object->SetNumberField(TEXT("ReplayMaxFrameMs"), Result.ReplayStats.MaxFrameMs);
+		}
+		Object->SetNumberField(TEXT("PeakUsedPhysicalBytes"), static_cast<double>(Result.PeakUsedPhysicalBytes));
+		Object->SetNumberField(TEXT("VoxelMemoryBytes"), static_cast<double>(Result.VoxelMemoryBytes));
+		Object->SetNumberField(TEXT("ResultBuffersAllocated"), Result.ResultBuffersAllocated);
+		Object->SetNumberField(TEXT("ResultBuffersReused"), Result.ResultBuffersReused);
+
+		const TSharedRef<FJsonObject> Stages = MakeShared<FJsonObject>();
+		for (int32 i = 0; i < Result.StageMs.Num(); ++i)
+		{
+			const TSharedRef<FJsonObject> Stage = MakeShared<FJsonObject>();
+			Stage->SetNumberField(TEXT("TotalMs"), Result.StageMs[i].Value);
+			Stage->SetNumberField(TEXT("Calls"), static_cast<double>(Result.StageCalls[i].Value));
+			Stages->SetObjectField(Result.StageMs[i].Key, Stage);
+		}
+		Object->SetObjectField(TEXT("Stages"), Stages);
+
+		const TSharedRef<FJsonObject> MesherLODs = MakeShared<FJsonObject>();
+		for (const FMesherLODResult& LOD : Result.MesherLODs)
+		{
+			const TSharedRef<FJsonObject> LODObject = MakeShared<FJsonObject>();
+			LODObject->SetNumberField(TEXT("AvgMs"), LOD.AvgMs);
+			LODObject->SetNumberField(TEXT("Vertices"), LOD.Vertices);
+			LODObject->SetNumberField(TEXT("Triangles"), LOD.Triangles);
+			MesherLODs->SetObjectField(FString::FromInt(LOD.LODLevel), LODObject);
+		}
+		Object->SetObjectField(TEXT("MesherLODs"), MesherLODs);
+
+		ScenarioValues.Add(MakeShared<FJsonValueObject>(Object));
+	}
+
+	const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+	Root->SetArrayField(TEXT("Scenarios"), ScenarioValues);
+
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	if (!FJsonSerializer::Serialize(Root, Writer))
+		return false;
+
+	return FFileHelper::SaveStringToFile(Output, *Path);
+}
+
+bool UVoxelBenchmarkCommandlet::WriteCsv(const FString& Path, const TArray<FScenarioResult>& Results)
+{
+	FString Output = TEXT("CellSize,CellNum,ChunkNum,DensityLayout,Mesher,Completed,ChunkCount,BuildTimeMs,BuildFrames,FirstVisibleMs,ChunksBuilt,TrianglesBuilt,")
+		TEXT("SculptsApplied,SculptAvgMs,SculptMaxMs,PeakUsedPhysicalBytes,VoxelMemoryBytes,ResultBuffersAllocated,ResultBuffersReused,")
+		TEXT("ReplaySculpts,ReplayFrames,ReplayAvgFrameMs,ReplayP95FrameMs,ReplayMaxFrameMs");
+
+	if (Results.Num() > 0)
+	{
+		for (const TPair<FString, double>& Stage : Results[0].StageMs)
+		{
+			Output += FString::Printf(TEXT(",%sMs,%sCalls"), *Stage.Key, *Stage.Key);
+		}
+		for (const FMesherLODResult& LOD : Results[0].MesherLODs)
+		{
+			Output += FString::Printf(TEXT(",MesherLOD%dMs,MesherLOD%dVertices,MesherLOD%dTriangles"), LOD.LODLevel, LOD.LODLevel, LOD.LODLevel);
+		}
+	}
+	Output += LINE_TERMINATOR;
+
+	for (const FScenarioResult& Result : Results)
+	{
+		Output += FString::Printf(TEXT("%d,%d,%d,%s,%s,%d,%d,%.3f,%d,%.3f,%llu,%llu,%d,%.4f,%.4f,%llu,%lld,%lld,%lld"),
+			Result.Scenario.CellSize, Result.Scenario.CellNum, Result.Scenario.ChunkNum,
+			*GetEnumName(Result.Scenario.DensityLayout), *GetEnumName(Result.Scenario.MesherType),
+			Result.bCompleted ? 1 : 0,
+			Result.ChunkCount, Result.BuildTimeMs, Result.BuildFrames, Result.FirstVisibleMs, Result.ChunksBuilt, Result.TrianglesBuilt,
+			Result.SculptsApplied, Result.SculptsApplied > 0 ? Result.SculptTotalMs / Result.SculptsApplied : 0.0,
+			Result.SculptMaxMs, Result.PeakUsedPhysicalBytes, Result.VoxelMemoryBytes, Result.ResultBuffersAllocated, Result.ResultBuffersReused);
+		Output += FString::Printf(TEXT(",%d,%d,%.3f,%.3f,%.3f"), Result.ReplayStats.SculptCount, Result.ReplayStats.Frames,
+			Result.ReplayStats.AvgFrameMs, Result.ReplayStats.P95FrameMs, Result.ReplayStats.MaxFrameMs);
+
+		for (int32 i = 0; i < Result.StageMs.Num(); ++i)
+		{
+			Output += FString::Printf(TEXT(",%.3f,%llu"), Result.StageMs[i].Value, Result.StageCalls[i].Value);
+		}
+		for (const FMesherLODResult& LOD : Result.MesherLODs)
+		{
+			Output += FString::Printf(TEXT(",%.4f,%d,%d"), LOD.AvgMs, LOD.Vertices, LOD.Triangles);
+		}
+		Output += LINE_TERMINATOR;
+	}
+
+	return FFileHelper::SaveStringToFile(Output, *Path);
+}
@@ -0,0 +1,105 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "Planet/Voxel/Defines/VoxelStructs.h"
+#include "Planet/Voxel/etc/VoxelDigRecording.h"
+#include "VoxelBenchmarkCommandlet.generated.h"
+
+class UVoxelManager;
+
+/*
+ * Voxel 생성/Sculpt 성능 측정용 Headless Commandlet
+ *
+ * UnrealEditor-Cmd Eclipser.uproject -run=VoxelBenchmark -nullrhi -unattended
+ *   -CellSize=100 -CellNum=16,32 -ChunkNum=8 -LOD=0:1,3000:2,6000:4:500 (Distance:Level[:TriangleBudget])
+ *   -Budget=20 -SculptCount=50 -SculptRadius=150 -Seed=1234 -Output=Saved/VoxelBenchmark/result.json
+ *   -MemoryBudgetMB=512 (0이면 제한 없음)
+ *
+ * -RenderFree 를 주면 Dedicated Server와 같은 Render-Free 모드로 실행, 표면 위 기준 위치 주변 Chunk의 Density만 올려서 측정
+ *
+ * -Layout=Linear,Tiled, -Mesher=MarchingCubes,SurfaceNets,DualContouring 로 조합별로 같은 Scenario를 반복하고,
+ * 각 조합에서 표면 Chunk 하나를 LOD 1/2/4/8로 Meshing한 시간과 정점/삼각형 수도 측정 (-MesherIterations=20)
+ *
+ * -Replay=Saved/VoxelRecordings/Dig.vdig 를 주면 초기 생성 후 기록된 Dig 세션을 Replay하고 Frame 시간을 함께 저장 (Planet 설정은 기록 값 사용)
+ *
+ * CellNum / ChunkNum은 쉼표로 여러 값을 주면 모든 조합을 순서대로 측정하고, 결과는 JSON 또는 CSV(.csv 확장자)로 저장
+ */
+UCLASS()
+class ECLIPSER_API UVoxelBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UVoxelBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	struct FScenario
+	{
+		int32 CellSize = 100;
+		int32 CellNum = 32;
+		int32 ChunkNum = 8;
+		TArray<FLODDistanceLevel> LODLevels;
+		int32 MaxChunksPerFrame = 20;
+		float TimeBudgetMs = 0.0f;
+		int32 SculptCount = 0;
+		float SculptRadius = 150.0f;
+		int32 MemoryBudgetMB = 0;
+		int32 Seed = 1234;
+		EVoxelDensityLayout DensityLayout = EVoxelDensityLayout::Linear;
+		EVoxelMesherType MesherType = EVoxelMesherType::MarchingCubes;
+		int32 MesherIterations = 20;
+		bool bRenderFree = false;
+		TSharedPtr<const FVoxelDigRecording> Replay;
+	};
+
+	struct FMesherLODResult
+	{
+		int32 LODLevel = 1;
+		double AvgMs = 0.0;
+		int32 Vertices = 0;
+		int32 Triangles = 0;
+	};
+
+	struct FScenarioResult
+	{
+		FScenario Scenario;
+		bool bCompleted = false;
+		double BuildTimeMs = 0.0;
+		double FirstVisibleMs = 0.0;
+		int32 BuildFrames = 0;
+		int32 ChunkCount = 0;
+		uint64 ChunksBuilt = 0;
+		uint64 TrianglesBuilt = 0;
+		int32 SculptsApplied = 0;
+		double SculptTotalMs = 0.0;
+		double SculptMaxMs = 0.0;
+		TArray<TPair<FString, double>> StageMs;
+		TArray<TPair<FString, uint64>> StageCalls;
+		uint64 PeakUsedPhysicalBytes = 0;
+		int64 VoxelMemoryBytes = 0;
+		int64 ResultBuffersAllocated = 0;
+		int64 ResultBuffersReused = 0;
+		bool bReplayed = false;
+		FVoxelDigReplayStats ReplayStats;
+		// 표면 Chunk 하나의 LOD별 평균 Meshing 시간과 결과 크기
+		TArray<FMesherLODResult> MesherLODs;
+	};
+
+	FScenarioResult RunScenario(const FScenario& Scenario, float TimeoutSeconds);
+	static void CollectStageTimings(FScenarioResult& Result);
+	static void MeasureMesherLODs(const FScenario& Scenario, FScenarioResult& Result);
+	static TArray<FLODDistanceLevel> ParseLODLevels(const FString& Value);
+	static TArray<int32> ParseIntList(const FString& Value, int32 DefaultValue);
+	template <typename EnumType>
+	static TArray<EnumType> ParseEnumList(const FString& Value, EnumType DefaultValue);
+	template <typename EnumType>
+	static FString GetEnumName(EnumType Value);
+
+	static bool WriteJson(const FString& Path, const TArray<FScenarioResult>& Results);
+	static bool WriteCsv(const FString& Path, const TArray<FScenarioResult>& Results);
+};
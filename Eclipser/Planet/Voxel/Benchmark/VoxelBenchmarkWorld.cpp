@@ -0,0 +1,59 @@
+#include "VoxelBenchmarkWorld.h"
+
+#include "Eclipser.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Planet/Planet.h"
+#include "Planet/Voxel/VoxelManager.h"
+
+FVoxelBenchmarkWorld::FVoxelBenchmarkWorld()
+{
+	World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("VoxelBenchmarkWorld"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->GetWorldSettings()->NotifyBeginPlay();
+}
+
+FVoxelBenchmarkWorld::~FVoxelBenchmarkWorld()
+{
+	World->BeginTearingDown();
+	World->DestroyWorld(false);
+	GEngine->DestroyWorldContext(World);
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+UVoxelManager* FVoxelBenchmarkWorld::SpawnPlanet(TFunctionRef<void(UVoxelManager&)> Configure)
+{
+	// BeginPlay 전에 설정을 넣어야 하므로 Deferred Spawn
+	APlanet* Planet = World->SpawnActorDeferred<APlanet>(APlanet::StaticClass(), FTransform::Identity);
+	UVoxelManager* Manager = Planet->VoxelManager;
+	Configure(*Manager);
+	Planet->FinishSpawning(FTransform::Identity);
+	return Manager;
+}
+
+void FVoxelBenchmarkWorld::Tick()
+{
+	World->Tick(LEVELTICK_All, DeltaSeconds);
+}
+
+bool FVoxelBenchmarkWorld::TickUntil(TFunctionRef<bool()> Predicate, float TimeoutSeconds, int32& OutFrames)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	OutFrames = 0;
+
+	while (!Predicate())
+	{
+		if (FPlatformTime::Seconds() - StartTime > TimeoutSeconds)
+		{
+			UE_LOG(LogEclipser, Warning, TEXT("Voxel benchmark world timed out after %.1f s"), TimeoutSeconds);
+			return false;
+		}
+
+		Tick();
+		++OutFrames;
+	}
+	return true;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UVoxelManager;
+class UWorld;
+
+/*
+ * Commandlet과 Automation Test에서 Planet을 띄우기 위한 임시 Game World
+ * 생성 시 BeginPlay까지 진행하고, 소멸 시 World와 WorldContext를 정리
+ */
+class FVoxelBenchmarkWorld
+{
+public:
+	FVoxelBenchmarkWorld();
+	~FVoxelBenchmarkWorld();
+
+	UWorld* GetWorld() const { return World; }
+
+	// Configure는 Manager의 BeginPlay 전에 호출되므로 CellSize 등 생성 설정을 여기서 변경
+	UVoxelManager* SpawnPlanet(TFunctionRef<void(UVoxelManager&)> Configure);
+
+	void Tick();
+	// Predicate가 true가 될 때까지 Tick, 시간 초과면 false
+	bool TickUntil(TFunctionRef<bool()> Predicate, float TimeoutSeconds, int32& OutFrames);
+
+	static constexpr float DeltaSeconds = 1.0f / 60.0f;
+
+private:
+	UWorld* World = nullptr;
+};
@@ -0,0 +1,73 @@
+#include "VoxelTestHelper.h"
+
+#include "Planet/Voxel/etc/VoxelHelper.h"
+
+FChunkSettingInfo VoxelTestHelper::MakeTestInfo(int32 CellNum, int32 LODLevel)
+{
+	FChunkSettingInfo Info;
+	Info.ChunkIndex = FIntVector::ZeroValue;
+	Info.CellSize = TestCellSize;
+	Info.CellNum = CellNum;
+	Info.ChunkNum = 1;
+	Info.LODLevel = LODLevel;
+	Info.Apron = 1;
+	Info.Calculate();
+	return Info;
+}
+
+void VoxelTestHelper::FillDensity(const FChunkSettingInfo& Info, TFunctionRef<float(const FVector&)> Field,
+	TArray<FVertexDensity>& OutDensityData)
+{
+	OutDensityData.SetNum(VoxelHelper::GetDensityDataNum(Info));
+
+	for (int32 z = -Info.Apron; z <= Info.CellNum + Info.Apron; ++z)
+		for (int32 y = -Info.Apron; y <= Info.CellNum + Info.Apron; ++y)
+			for (int32 x = -Info.Apron; x <= Info.CellNum + Info.Apron; ++x)
+			{
+				OutDensityData[VoxelHelper::GetIndex(x, y, z, Info)].Density = Field(FVector(x, y, z));
+			}
+}
+
+bool VoxelTestHelper::IsClosedManifold(const FVoxelData& MeshData, FString& OutError)
+{
+	// 인접 Cell이 같은 Edge에서 만든 정점은 위치가 (거의) 같으므로 격자에 맞춰서 합침
+	TMap<FIntVector, int32> WeldedIds;
+	TArray<int32> VertexToWelded;
+	VertexToWelded.Reserve(MeshData.Vertices.Num());
+	for (const FVector& Vertex : MeshData.Vertices)
+	{
+		const FIntVector Key(FMath::RoundToInt(Vertex.X * 16.0), FMath::RoundToInt(Vertex.Y * 16.0), FMath::RoundToInt(Vertex.Z * 16.0));
+		VertexToWelded.Add(WeldedIds.FindOrAdd(Key, WeldedIds.Num()));
+	}
+
+	TMap<TPair<int32, int32>, int32> DirectedEdges;
+	for (int32 i = 0; i + 2 < MeshData.Triangles.Num(); i += 3)
+	{
+		const int32 Ids[3] = {
+			VertexToWelded[MeshData.Triangles[i]], VertexToWelded[MeshData.Triangles[i + 1]], VertexToWelded[MeshData.Triangles[i + 2]] };
+
+		for (int32 e = 0; e < 3; ++e)
+		{
+			++DirectedEdges.FindOrAdd(TPair<int32, int32>(Ids[e], Ids[(e + 1) % 3]), 0);
+		}
+	}
+
+	for (const TPair<TPair<int32, int32>, int32>& Edge : DirectedEdges)
+	{
+		const int32* Opposite = DirectedEdges.Find(TPair<int32, int32>(Edge.Key.Value, Edge.Key.Key));
+		if (Edge.Value != 1 || !Opposite || *Opposite != 1)
+		{
+			OutError = FString::Printf(TEXT("edge (%d, %d) used %d time(s), opposite %d time(s)"),
+				Edge.Key.Key, Edge.Key.Value, Edge.Value, Opposite ? *Opposite : 0);
+			return false;
+		}
+	}
+	return true;
+}
+
+uint32 VoxelTestHelper::HashMesh(const FVoxelData& MeshData)
+{
+	uint32 Hash = FCrc::MemCrc32(MeshData.Vertices.GetData(), MeshData.Vertices.Num() * MeshData.Vertices.GetTypeSize());
+	Hash = FCrc::MemCrc32(MeshData.Normals.GetData(), MeshData.Normals.Num() * MeshData.Normals.GetTypeSize(), Hash);
+	return FCrc::MemCrc32(MeshData.Triangles.GetData(), MeshData.Triangles.Num() * MeshData.Triangles.GetTypeSize(), Hash);
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Planet/Voxel/Defines/VoxelStructs.h"
+
+/*
+ * Voxel Automation Test (Eclipser.Voxel.*)와 VoxelValidation Commandlet이 같이 쓰는 Density / Mesh 검사 함수
+ */
+class VoxelTestHelper
+{
+public:
+	static constexpr int32 TestCellSize = 100;
+	static constexpr float TimeoutSeconds = 120.0f;
+
+	static FChunkSettingInfo MakeTestInfo(int32 CellNum, int32 LODLevel);
+	// Field는 Chunk Local Cell 단위 좌표를 받아 Density를 반환
+	static void FillDensity(const FChunkSettingInfo& Info, TFunctionRef<float(const FVector&)> Field, TArray<FVertexDensity>& OutDensityData);
+	// 위치가 같은 정점을 합쳤을 때 모든 방향 Edge가 반대 방향 Edge와 정확히 한 번씩 짝을 이루는지 검사
+	static bool IsClosedManifold(const FVoxelData& MeshData, FString& OutError);
+	static uint32 HashMesh(const FVoxelData& MeshData);
+};
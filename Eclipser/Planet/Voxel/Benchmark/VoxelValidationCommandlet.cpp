@@ -0,0 +1,104 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VoxelValidationCommandlet.h"
+
+#include "VoxelTestHelper.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Planet/MarchingCube/MarchingCubeMeshGenerator.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVoxelValidation, Log, All);
+
+UVoxelValidationCommandlet::UVoxelValidationCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UVoxelValidationCommandlet::Main(const FString& Params)
+{
+	FString BaselinePath = FPaths::ProjectSavedDir() / TEXT("VoxelValidation") / TEXT("MesherBaseline.json");
+	float Margin = 0.2f;
+	int32 Iterations = 50;
+	FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+	FParse::Value(*Params, TEXT("Margin="), Margin);
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	const bool bUpdateBaseline = FParse::Param(*Params, TEXT("UpdateBaseline"));
+
+	const bool bPassed = CheckReferenceTiming(BaselinePath, Margin, Iterations, bUpdateBaseline);
+	UE_LOG(LogVoxelValidation, Display, TEXT("ReferenceTiming: %s"), bPassed ? TEXT("Passed") : TEXT("FAILED"));
+	return bPassed ? 0 : 1;
+}
+
+bool UVoxelValidationCommandlet::CheckReferenceTiming(const FString& BaselinePath, float Margin, int32 Iterations, bool bUpdateBaseline)
+{
+	// 표면이 Chunk 전체를 가로지르는 기준 Chunk를 여러 번 Meshing해서 중앙값 사용
+	const FChunkSettingInfo Info = VoxelTestHelper::MakeTestInfo(32, 1);
+	const FVector Center(16.0f, 16.0f, -20.0f);
+	const float Radius = 34.37f;
+
+	TArray<FVertexDensity> DensityData;
+	VoxelTestHelper::FillDensity(Info, [&](const FVector& CellPos) { return Radius - FVector::Dist(CellPos, Center); }, DensityData);
+
+	FVoxelData MeshData;
+	for (int32 i = 0; i < 3; ++i)
+	{
+		MarchingCubeMeshGenerator::GenerateChunkMesh(Info, DensityData, MeshData);
+	}
+
+	TArray<double> Samples;
+	Samples.Reserve(FMath::Max(Iterations, 1));
+	for (int32 i = 0; i < FMath::Max(Iterations, 1); ++i)
+	{
+		const double Start = FPlatformTime::Seconds();
+		MarchingCubeMeshGenerator::GenerateChunkMesh(Info, DensityData, MeshData);
+		Samples.Add((FPlatformTime::Seconds() - Start) * 1000.0);
+	}
+	Samples.Sort();
+	const double MedianMs = Samples[Samples.Num() / 2];
+
+	UE_LOG(LogVoxelValidation, Display, TEXT("Reference chunk: %.3f ms median, %d triangles"), MedianMs, MeshData.Triangles.Num() / 3);
+
+	double BaselineMs = 0.0;
+	FString BaselineText;
+	if (!bUpdateBaseline && FFileHelper::LoadFileToString(BaselineText, *BaselinePath))
+	{
+		TSharedPtr<FJsonObject> BaselineObject;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BaselineText);
+		if (!FJsonSerializer::Deserialize(Reader, BaselineObject) || !BaselineObject.IsValid()
+			|| !BaselineObject->TryGetNumberField(TEXT("ReferenceChunkMs"), BaselineMs))
+		{
+			UE_LOG(LogVoxelValidation, Error, TEXT("Invalid baseline file %s"), *BaselinePath);
+			return false;
+		}
+
+		const double LimitMs = BaselineMs * (1.0 + Margin);
+		if (MedianMs > LimitMs)
+		{
+			UE_LOG(LogVoxelValidation, Error, TEXT("Reference chunk took %.3f ms, baseline %.3f ms + %.0f%% = %.3f ms"), MedianMs, BaselineMs, Margin * 100.0f, LimitMs);
+			return false;
+		}
+		return true;
+	}
+
+	const TSharedRef<FJsonObject> BaselineObject = MakeShared<FJsonObject>();
+	BaselineObject->SetNumberField(TEXT("ReferenceChunkMs"), MedianMs);
+	BaselineObject->SetNumberField(TEXT("ReferenceChunkTriangles"), MeshData.Triangles.Num() / 3);
+
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(BaselineObject, Writer);
+	if (!FFileHelper::SaveStringToFile(Output, *BaselinePath))
+	{
+		UE_LOG(LogVoxelValidation, Error, TEXT("Failed to write baseline %s"), *BaselinePath);
+		return false;
+	}
+	UE_LOG(LogVoxelValidation, Display, TEXT("Baseline written to %s"), *BaselinePath);
+	return true;
+}
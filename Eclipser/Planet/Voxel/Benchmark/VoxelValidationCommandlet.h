@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "VoxelValidationCommandlet.generated.h"
+
+/*
+ * Mesher 성능 회귀 검사용 Headless Commandlet, 정확성 검사는 Automation Test로 실행
+ *
+ * UnrealEditor-Cmd Eclipser.uproject -run=VoxelValidation -nullrhi -unattended
+ *   -Baseline=Saved/VoxelValidation/MesherBaseline.json -Margin=0.2 -Iterations=50 [-UpdateBaseline]
+ * UnrealEditor-Cmd Eclipser.uproject -nullrhi -unattended -ExecCmds="Automation RunTests Eclipser.Voxel; Quit"
+ *
+ * 기준 Chunk Meshing 시간이 Baseline * (1 + Margin)을 넘으면 1을 반환
+ * Baseline 파일이 없거나 -UpdateBaseline이면 현재 측정값을 Baseline으로 저장
+ */
+UCLASS()
+class ECLIPSER_API UVoxelValidationCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UVoxelValidationCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	// 실패하면 false
+	static bool CheckReferenceTiming(const FString& BaselinePath, float Margin, int32 Iterations, bool bUpdateBaseline);
+};
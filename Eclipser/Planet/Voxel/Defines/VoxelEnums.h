@@ -28,4 +28,33 @@ enum class ECubeCorner : uint8
 	FrontRightBottom  UMETA(DisplayName = "Front Right Bottom"),  // (7)
 
 	MAX UMETA(Hidden)  // 내부 반복용 (총 8개)
-};
\ No newline at end of file
+};
+
+// Chunk Density 배열의 메모리 배치
+UENUM(BlueprintType)
+enum class EVoxelDensityLayout : uint8
+{
+	// X -> Y -> Z 순서의 1차원 배열
+	Linear  UMETA(DisplayName = "Linear"),
+	// 4x4x4 Tile 단위로 묶고 Tile 안은 Morton(Z-order) 순서, 큰 LOD Step이나 Sculpt 영역 접근이 Tile 안에 모임
+	Tiled   UMETA(DisplayName = "Tiled (Morton)"),
+};
+
+// Density에서 표면 Mesh를 뽑는 방식
+UENUM(BlueprintType)
+enum class EVoxelMesherType : uint8
+{
+	MarchingCubes   UMETA(DisplayName = "Marching Cubes"),
+	// Cell마다 정점 하나, 같은 격자에서 삼각형 수가 크게 줄어듦
+	SurfaceNets     UMETA(DisplayName = "Surface Nets"),
+	// Surface Nets 정점을 QEF로 옮겨서 파낸 모서리를 날카롭게 유지
+	DualContouring  UMETA(DisplayName = "Dual Contouring"),
+};
+
+// 네트워크로 전달되는 Sculpt Brush 종류
+UENUM(BlueprintType)
+enum class EVoxelSculptMode : uint8
+{
+	// 구 안쪽 Density를 낮춰서 파냄
+	Dig     UMETA(DisplayName = "Dig"),
+};
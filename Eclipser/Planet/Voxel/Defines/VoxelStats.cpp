@@ -0,0 +1,115 @@
+#include "VoxelStats.h"
+
+DEFINE_STAT(STAT_VoxelBuildTask);
+DEFINE_STAT(STAT_VoxelGenerateDensity);
+DEFINE_STAT(STAT_VoxelApplyOverrides);
+DEFINE_STAT(STAT_VoxelMarching);
+DEFINE_STAT(STAT_VoxelSimplify);
+DEFINE_STAT(STAT_VoxelCacheLoad);
+DEFINE_STAT(STAT_VoxelCacheSave);
+DEFINE_STAT(STAT_VoxelCookedLoad);
+DEFINE_STAT(STAT_VoxelMeshApply);
+DEFINE_STAT(STAT_VoxelClusterBuild);
+DEFINE_STAT(STAT_VoxelCollision);
+DEFINE_STAT(STAT_VoxelSculpt);
+DEFINE_STAT(STAT_VoxelCreateComponents);
+DEFINE_STAT(STAT_VoxelProcessCompleted);
+DEFINE_STAT(STAT_VoxelUpdateLOD);
+DEFINE_STAT(STAT_VoxelRaycast);
+DEFINE_STAT(STAT_VoxelQueryDensity);
+
+DEFINE_STAT(STAT_VoxelBuildsInFlight);
+DEFINE_STAT(STAT_VoxelCompletedQueueDepth);
+DEFINE_STAT(STAT_VoxelCollisionQueueDepth);
+DEFINE_STAT(STAT_VoxelDiscardedBuilds);
+DEFINE_STAT(STAT_VoxelCacheHits);
+DEFINE_STAT(STAT_VoxelCacheMisses);
+DEFINE_STAT(STAT_VoxelMergedClusters);
+DEFINE_STAT(STAT_VoxelNetSculptBytes);
+DEFINE_STAT(STAT_VoxelNetSnapshotBytes);
+DEFINE_STAT(STAT_VoxelMeshDataReleases);
+DEFINE_STAT(STAT_VoxelDensityEvictions);
+DEFINE_STAT(STAT_VoxelDensityReloads);
+DEFINE_STAT(STAT_VoxelChunksPerFrame);
+DEFINE_STAT(STAT_VoxelCollisionCooksPerFrame);
+
+DEFINE_STAT(STAT_VoxelDensityMemory);
+DEFINE_STAT(STAT_VoxelMeshMemory);
+DEFINE_STAT(STAT_VoxelCollisionMemory);
+DEFINE_STAT(STAT_VoxelRenderMeshMemory);
+DEFINE_STAT(STAT_VoxelResultPoolMemory);
+DEFINE_STAT(STAT_VoxelSculptRecordMemory);
+DEFINE_STAT(STAT_VoxelClusterMeshMemory);
+DEFINE_STAT(STAT_VoxelDensityBatchMemory);
+DEFINE_STAT(STAT_VoxelMemoryBudget);
+
+UE_TRACE_CHANNEL_DEFINE(VoxelChannel);
+
+TRACE_DECLARE_INT_COUNTER(VoxelCompletedQueueDepth, TEXT("Voxel/CompletedQueueDepth"));
+TRACE_DECLARE_INT_COUNTER(VoxelChunksPerFrame, TEXT("Voxel/ChunksPerFrame"));
+TRACE_DECLARE_INT_COUNTER(VoxelDiscardedBuilds, TEXT("Voxel/DiscardedBuilds"));
+
+FVoxelPipelineCounters& FVoxelPipelineCounters::Get()
+{
+	static FVoxelPipelineCounters Instance;
+	return Instance;
+}
+
+const TCHAR* FVoxelPipelineCounters::GetStageName(EVoxelPipelineStage Stage)
+{
+	switch (Stage)
+	{
+	case EVoxelPipelineStage::BuildTask:		return TEXT("BuildTask");
+	case EVoxelPipelineStage::GenerateDensity:	return TEXT("GenerateDensity");
+	case EVoxelPipelineStage::ApplyOverrides:	return TEXT("ApplyOverrides");
+	case EVoxelPipelineStage::Marching:			return TEXT("Marching");
+	case EVoxelPipelineStage::Simplify:			return TEXT("Simplify");
+	case EVoxelPipelineStage::CacheLoad:		return TEXT("CacheLoad");
+	case EVoxelPipelineStage::CacheSave:		return TEXT("CacheSave");
+	case EVoxelPipelineStage::CookedLoad:		return TEXT("CookedLoad");
+	case EVoxelPipelineStage::MeshApply:		return TEXT("MeshApply");
+	case EVoxelPipelineStage::ClusterBuild:		return TEXT("ClusterBuild");
+	case EVoxelPipelineStage::Collision:		return TEXT("Collision");
+	case EVoxelPipelineStage::Sculpt:			return TEXT("Sculpt");
+	case EVoxelPipelineStage::CreateComponents:	return TEXT("CreateComponents");
+	case EVoxelPipelineStage::ProcessCompleted:	return TEXT("ProcessCompleted");
+	case EVoxelPipelineStage::UpdateLOD:		return TEXT("UpdateLOD");
+	case EVoxelPipelineStage::Raycast:			return TEXT("Raycast");
+	case EVoxelPipelineStage::QueryDensity:		return TEXT("QueryDensity");
+	default:									return TEXT("Unknown");
+	}
+}
+
+void FVoxelPipelineCounters::AddStage(EVoxelPipelineStage Stage, uint64 Cycles)
+{
+	const int32 Index = static_cast<int32>(Stage);
+	StageCycles[Index].fetch_add(Cycles, std::memory_order_relaxed);
+	StageCalls[Index].fetch_add(1, std::memory_order_relaxed);
+}
+
+void FVoxelPipelineCounters::AddChunkBuilt(int32 TriangleCount)
+{
+	ChunksBuilt.fetch_add(1, std::memory_order_relaxed);
+	TrianglesBuilt.fetch_add(TriangleCount, std::memory_order_relaxed);
+}
+
+void FVoxelPipelineCounters::Reset()
+{
+	for (int32 i = 0; i < static_cast<int32>(EVoxelPipelineStage::Num); ++i)
+	{
+		StageCycles[i].store(0, std::memory_order_relaxed);
+		StageCalls[i].store(0, std::memory_order_relaxed);
+	}
+	ChunksBuilt.store(0, std::memory_order_relaxed);
+	TrianglesBuilt.store(0, std::memory_order_relaxed);
+}
+
+double FVoxelPipelineCounters::GetStageMs(EVoxelPipelineStage Stage) const
+{
+	return FPlatformTime::ToMilliseconds64(StageCycles[static_cast<int32>(Stage)].load(std::memory_order_relaxed));
+}
+
+uint64 FVoxelPipelineCounters::GetStageCalls(EVoxelPipelineStage Stage) const
+{
+	return StageCalls[static_cast<int32>(Stage)].load(std::memory_order_relaxed);
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+/*
+ * Voxel Chunk 파이프라인 계측
+ * - stat Voxel : 단계별 Cycle / 메모리 / Queue 상태
+ * - Unreal Insights : -trace=cpu,Voxel 로 VoxelChannel 이벤트와 Counter 확인
+ */
+
+DECLARE_STATS_GROUP(TEXT("Voxel"), STATGROUP_Voxel, STATCAT_Advanced);
+
+// 단계별 시간
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Build Task"), STAT_VoxelBuildTask, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Generate Density"), STAT_VoxelGenerateDensity, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Sculpt Overrides"), STAT_VoxelApplyOverrides, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Marching Cubes"), STAT_VoxelMarching, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Mesh Simplify"), STAT_VoxelSimplify, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cache Load"), STAT_VoxelCacheLoad, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cache Save"), STAT_VoxelCacheSave, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cooked Load"), STAT_VoxelCookedLoad, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Mesh Apply"), STAT_VoxelMeshApply, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cluster Build"), STAT_VoxelClusterBuild, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Collision Cook"), STAT_VoxelCollision, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sculpt"), STAT_VoxelSculpt, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Create Components"), STAT_VoxelCreateComponents, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Process Completed Chunks"), STAT_VoxelProcessCompleted, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update LOD"), STAT_VoxelUpdateLOD, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Raycast"), STAT_VoxelRaycast, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Density Query"), STAT_VoxelQueryDensity, STATGROUP_Voxel, ECLIPSER_API);
+
+// Queue / 처리량
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Builds In Flight"), STAT_VoxelBuildsInFlight, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Completed Queue Depth"), STAT_VoxelCompletedQueueDepth, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Collision Queue Depth"), STAT_VoxelCollisionQueueDepth, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Discarded Stale Builds"), STAT_VoxelDiscardedBuilds, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Disk Cache Hits"), STAT_VoxelCacheHits, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Disk Cache Misses"), STAT_VoxelCacheMisses, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Merged Clusters"), STAT_VoxelMergedClusters, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Net Sculpt Bytes Sent"), STAT_VoxelNetSculptBytes, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Net Snapshot Bytes Sent"), STAT_VoxelNetSnapshotBytes, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Budget Mesh Data Releases"), STAT_VoxelMeshDataReleases, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Budget Density Evictions"), STAT_VoxelDensityEvictions, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Density Reloads"), STAT_VoxelDensityReloads, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Chunks Applied / Frame"), STAT_VoxelChunksPerFrame, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Collision Cooks / Frame"), STAT_VoxelCollisionCooksPerFrame, STATGROUP_Voxel, ECLIPSER_API);
+
+// 메모리
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Density Memory"), STAT_VoxelDensityMemory, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Mesh Data Memory"), STAT_VoxelMeshMemory, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Collision Mesh Memory"), STAT_VoxelCollisionMemory, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Render Mesh Memory (Estimated)"), STAT_VoxelRenderMeshMemory, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Result Pool Memory"), STAT_VoxelResultPoolMemory, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Sculpt Record Memory"), STAT_VoxelSculptRecordMemory, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Cluster Mesh Memory (Estimated)"), STAT_VoxelClusterMeshMemory, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Density Batch Memory"), STAT_VoxelDensityBatchMemory, STATGROUP_Voxel, ECLIPSER_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Memory Budget"), STAT_VoxelMemoryBudget, STATGROUP_Voxel, ECLIPSER_API);
+
+UE_TRACE_CHANNEL_EXTERN(VoxelChannel, ECLIPSER_API);
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(VoxelCompletedQueueDepth);
+TRACE_DECLARE_INT_COUNTER_EXTERN(VoxelChunksPerFrame);
+TRACE_DECLARE_INT_COUNTER_EXTERN(VoxelDiscardedBuilds);
+
+// Stat 없이도(Commandlet, Shipping 계측 등) 읽을 수 있는 단계별 누적 시간, STAT_Voxel<Stage>와 이름을 맞춤
+enum class EVoxelPipelineStage : uint8
+{
+	BuildTask,
+	GenerateDensity,
+	ApplyOverrides,
+	Marching,
+	Simplify,
+	CacheLoad,
+	CacheSave,
+	CookedLoad,
+	MeshApply,
+	ClusterBuild,
+	Collision,
+	Sculpt,
+	CreateComponents,
+	ProcessCompleted,
+	UpdateLOD,
+	Raycast,
+	QueryDensity,
+
+	Num
+};
+
+class ECLIPSER_API FVoxelPipelineCounters
+{
+public:
+	static FVoxelPipelineCounters& Get();
+	static const TCHAR* GetStageName(EVoxelPipelineStage Stage);
+
+	void AddStage(EVoxelPipelineStage Stage, uint64 Cycles);
+	void AddChunkBuilt(int32 TriangleCount);
+	void Reset();
+
+	double GetStageMs(EVoxelPipelineStage Stage) const;
+	uint64 GetStageCalls(EVoxelPipelineStage Stage) const;
+	uint64 GetChunksBuilt() const { return ChunksBuilt.load(std::memory_order_relaxed); }
+	uint64 GetTrianglesBuilt() const { return TrianglesBuilt.load(std::memory_order_relaxed); }
+
+private:
+	std::atomic<uint64> StageCycles[static_cast<int32>(EVoxelPipelineStage::Num)] = {};
+	std::atomic<uint64> StageCalls[static_cast<int32>(EVoxelPipelineStage::Num)] = {};
+	std::atomic<uint64> ChunksBuilt{0};
+	std::atomic<uint64> TrianglesBuilt{0};
+};
+
+struct FVoxelScopedStageTimer
+{
+	explicit FVoxelScopedStageTimer(EVoxelPipelineStage InStage)
+		: Stage(InStage), StartCycles(FPlatformTime::Cycles64()) {}
+	~FVoxelScopedStageTimer()
+	{
+		FVoxelPipelineCounters::Get().AddStage(Stage, FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	EVoxelPipelineStage Stage;
+	uint64 StartCycles;
+};
+
+// Stat Cycle Counter, Insights VoxelChannel 이벤트, 단계별 누적 시간을 같이 기록
+#define VOXEL_SCOPE_STAGE(Stage) \
+	SCOPE_CYCLE_COUNTER(STAT_Voxel##Stage); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Voxel##Stage, VoxelChannel); \
+	FVoxelScopedStageTimer PREPROCESSOR_JOIN(VoxelStageTimer_, __LINE__)(EVoxelPipelineStage::Stage)
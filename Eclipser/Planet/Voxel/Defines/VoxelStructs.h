@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "VoxelEnums.h"
 #include "VoxelStructs.generated.h"
 
 class UVoxelChunk;
@@ -15,6 +16,10 @@ struct FLODDistanceLevel
 
 	UPROPERTY(EditAnywhere, Category="Voxel|LOD", meta=(ClampMin="0.0", UIMin="0.0"))
 	float DistanceThreshold = 0.0f;
+
+	// 이 LOD로 만든 Chunk Mesh의 최대 삼각형 수, 넘으면 경계를 고정한 채 QEM으로 단순화 (0이면 단순화 안 함)
+	UPROPERTY(EditAnywhere, Category="Voxel|LOD", meta=(ClampMin="0", UIMin="0"))
+	int32 TriangleBudget = 0;
 };
 
 struct FChunkSettingInfo
@@ -33,6 +38,10 @@ struct FChunkSettingInfo
 	int CellNum;
 	int ChunkNum;
 	int LODLevel = 1;
+	int Apron = 1; // Chunk 경계 밖으로 추가 저장하는 꼭짓점 수
+	EVoxelDensityLayout DensityLayout = EVoxelDensityLayout::Linear;
+	EVoxelMesherType MesherType = EVoxelMesherType::MarchingCubes;
+	int32 TriangleBudget = 0; // 0이면 Mesh 단순화 안 함
 
 	
 	int ChunkSize;
@@ -80,10 +89,46 @@ struct FVoxelDataMappings
 	bool bIsLoaded = false;
 };
 
+/*
+ * Chunk 내부 Brick(BrickSize^3 Cell)별 Density 최소/최대값
+ * Brick은 경계 꼭짓점을 이웃 Brick과 공유하고, Chunk 가장자리 Brick은 Apron 꼭짓점까지 포함
+ * 부호가 바뀌지 않는 Brick은 Mesher / Sculpt / Raycast에서 통째로 건너뜀
+ */
+struct FVoxelBrickMinMax
+{
+	static constexpr int32 BrickShift = 3;
+	static constexpr int32 BrickSize = 1 << BrickShift;
+
+	int32 BrickNum = 0; // 축당 Brick 수
+	TArray<float> Min;
+	TArray<float> Max;
+
+	bool IsValid() const { return BrickNum > 0; }
+	int32 GetBrickIndex(int32 Bx, int32 By, int32 Bz) const { return Bx + (By + Bz * BrickNum) * BrickNum; }
+	// 꼭짓점 좌표가 속한 Brick (경계 꼭짓점은 위쪽 Brick, 범위 밖은 가장자리 Brick)
+	int32 CornerToBrick(int32 Corner) const { return FMath::Clamp(Corner >> BrickShift, 0, BrickNum - 1); }
+
+	bool IsAllNegative(int32 BrickIndex) const { return Max[BrickIndex] < 0.0f; }
+	bool IsAllPositive(int32 BrickIndex) const { return Min[BrickIndex] >= 0.0f; }
+	bool HasSignChange(int32 BrickIndex) const { return !IsAllNegative(BrickIndex) && !IsAllPositive(BrickIndex); }
+};
+
+// Chunk 하나가 들고 있는 메모리, UVoxelManager의 메모리 예산 계산에 사용
+struct FVoxelChunkMemory
+{
+	int64 DensityBytes = 0;     // Density + Brick Min/Max
+	int64 MeshDataBytes = 0;    // CachedMeshData (Render Mesh와 중복)
+	int64 CollisionBytes = 0;   // Collision 전용 Mesh
+	int64 RenderMeshBytes = 0;  // FDynamicMesh3 (추정값)
+
+	int64 GetTotal() const { return DensityBytes + MeshDataBytes + CollisionBytes + RenderMeshBytes; }
+};
+
 struct FChunkBuildResult
 {
 	FVoxelData MeshData;
 	TArray<FVertexDensity> DensityData;
+	FVoxelBrickMinMax BrickMinMax;
 };
 
 struct FPendingChunkResult
@@ -93,9 +138,27 @@ struct FPendingChunkResult
 	FChunkBuildResult Result;
 };
 
+struct FVoxelRaycastHit
+{
+	bool bBlockingHit = false;
+	FVector ImpactPoint = FVector::ZeroVector;
+	FVector ImpactNormal = FVector::ZeroVector;
+	float Distance = 0.0f;
+	TWeakObjectPtr<UVoxelChunk> Chunk;
+};
+
+struct FVoxelDensitySample
+{
+	float Density = 0.0f; // 양수면 Solid
+	FVector Gradient = FVector::ZeroVector;
+	int32 MaterialId = 0; // 가장 가까운 꼭짓점의 FVertexDensity::Id
+	bool bFromResidentChunk = false; // false면 절차적 Density로 계산한 값
+
+	bool IsSolid() const { return Density >= 0.0f; }
+};
+
 struct FChunkGenerationRequest
 {
-	UVoxelChunk* Chunk = nullptr;
 	FChunkSettingInfo Info;
 	float DistanceSquared = 0.0f;
 };
\ No newline at end of file
@@ -2,9 +2,45 @@
 
 #include "VoxelChunk.h"
 
+#include "Interface_CollisionDataProviderCore.h"
 #include "DynamicMesh/MeshNormals.h"
-#include "Planet/MarchingCube/MarchingCubeMeshGenerator.h"
+#include "Planet/Voxel/Defines/VoxelStats.h"
+#include "Planet/Voxel/etc/VoxelCookedPlanet.h"
+#include "Planet/Voxel/etc/VoxelDensityBatch.h"
 #include "Planet/Voxel/etc/VoxelHelper.h"
+#include "Planet/Voxel/etc/VoxelMeshSimplifier.h"
+#include "Planet/Voxel/etc/VoxelMesher.h"
+
+namespace
+{
+	constexpr int32 SampleLanes = 4;
+
+	// SampleIndices[Start]부터 4개 위치를 SoA로 모음, 남는 Lane은 마지막 샘플로 채우고 결과는 버림
+	int32 LoadSampleLanes(TConstArrayView<int32> SampleIndices, TConstArrayView<FVector> Positions, const FVector& Offset, int32 Start,
+		VectorRegister4Float& OutX, VectorRegister4Float& OutY, VectorRegister4Float& OutZ)
+	{
+		const int32 LaneCount = FMath::Min(SampleLanes, SampleIndices.Num() - Start);
+		alignas(16) float X[SampleLanes];
+		alignas(16) float Y[SampleLanes];
+		alignas(16) float Z[SampleLanes];
+		for (int32 Lane = 0; Lane < SampleLanes; ++Lane)
+		{
+			const FVector Position = Positions[SampleIndices[Start + FMath::Min(Lane, LaneCount - 1)]] - Offset;
+			X[Lane] = static_cast<float>(Position.X);
+			Y[Lane] = static_cast<float>(Position.Y);
+			Z[Lane] = static_cast<float>(Position.Z);
+		}
+		OutX = VectorLoadAligned(X);
+		OutY = VectorLoadAligned(Y);
+		OutZ = VectorLoadAligned(Z);
+		return LaneCount;
+	}
+
+	FORCEINLINE VectorRegister4Float VectorLerp(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& T)
+	{
+		return VectorMultiplyAdd(VectorSubtract(B, A), T, A);
+	}
+}
 
 
 UVoxelChunk::UVoxelChunk()
@@ -13,23 +49,65 @@ UVoxelChunk::UVoxelChunk()
 	
 }
 
-void UVoxelChunk::GenerateChunkMesh(const FChunkSettingInfo& Info, FChunkBuildResult&& Result)
+void UVoxelChunk::GenerateChunkMesh(const FChunkSettingInfo& Info, FChunkBuildResult& Result)
 {
-	ChunkInfo = Info;
-	ChunkDensityData = MoveTemp(Result.DensityData);
-	CachedMeshData = MoveTemp(Result.MeshData);
+	{
+		// Query 스레드가 ReadLock 안에서 ChunkInfo로 Index를 계산하므로 Density와 같이 교체
+		FWriteScopeLock WriteLock(DensityLock);
+		ChunkInfo = Info;
+		Swap(ChunkDensityData, Result.DensityData);
+		Swap(BrickMinMax, Result.BrickMinMax);
+	}
 	CurrentLODLevel = Info.LODLevel;
 	RequestedLODLevel = Info.LODLevel;
+	bDensityReleased = false;
+
+	// Render-Free면 Density만 받고 Collision은 필요할 때 Density에서 생성
+	if (bRenderFree)
+	{
+		UpdateMemoryStats();
+		MarkCollisionDirty();
+		return;
+	}
+
+	Swap(CachedMeshData, Result.MeshData);
+	bMeshDataReleased = false;
 	UpdateMesh(CachedMeshData);
+	UpdateMemoryStats();
+	MarkCollisionDirty();
+	if (OwningManager)
+	{
+		OwningManager->NotifyChunkMeshChanged(this);
+	}
 }
 
-FChunkBuildResult UVoxelChunk::GenerateChunkData(const FChunkSettingInfo& Info, UVoxelManager* Manager)
+void UVoxelChunk::GenerateChunkData(const FChunkSettingInfo& Info, UVoxelManager* Manager, FVoxelDensityBatch* Batch, FChunkBuildResult& OutResult)
 {
+	VOXEL_SCOPE_STAGE(BuildTask);
+
 	// 단순 계산이라 스레드 처리 가능
-	FChunkBuildResult Result;
-	GenerateChunkDensityData(Info, Result.DensityData, Manager);
-	Result.MeshData = MarchingCubeMeshGenerator::GenerateChunkMesh(Info, Result.DensityData);
-	return Result;
+	GenerateChunkDensityData(Info, OutResult.DensityData, Manager, Batch);
+	VoxelHelper::BuildBrickMinMax(Info, OutResult.DensityData, OutResult.BrickMinMax);
+	GenerateChunkMeshData(Info, Manager, OutResult);
+}
+
+void UVoxelChunk::GenerateChunkMeshData(const FChunkSettingInfo& Info, UVoxelManager* Manager, FChunkBuildResult& InOutResult)
+{
+	// Render-Free 모드는 Render Mesh를 쓰지 않음
+	if (Manager && Manager->IsRenderFree())
+	{
+		InOutResult.MeshData = FVoxelData();
+		return;
+	}
+
+	// Sculpt가 없는 Chunk는 구운 Mesh를 그대로 사용
+	const TSharedPtr<const FVoxelCookedPlanet, ESPMode::ThreadSafe> Cooked = Manager ? Manager->GetCookedPlanet() : TSharedPtr<const FVoxelCookedPlanet, ESPMode::ThreadSafe>();
+	if (!Cooked || Manager->GetSculptHash(Info.ChunkIndex) != 0 || !Cooked->LoadMesh(Info, InOutResult.MeshData))
+	{
+		VoxelMesher::GenerateChunkMesh(Info, InOutResult.DensityData, InOutResult.MeshData, &InOutResult.BrickMinMax);
+		VoxelMeshSimplifier::Simplify(InOutResult.MeshData, Info.TriangleBudget);
+	}
+	FVoxelPipelineCounters::Get().AddChunkBuilt(InOutResult.MeshData.Triangles.Num() / 3);
 }
 
 void UVoxelChunk::InitializeChunk(const FChunkSettingInfo& Info)
@@ -46,6 +124,8 @@ FChunkSettingInfo UVoxelChunk::MakeChunkSettingInfoForLOD(int32 LODLevel) const
 {
 	FChunkSettingInfo Info = ChunkInfo;
 	Info.LODLevel = FMath::Max(1, LODLevel);
+	// 삼각형 예산은 LOD별로 Manager가 정함
+	Info.TriangleBudget = 0;
 	Info.Calculate();
 	return Info;
 }
@@ -57,7 +137,7 @@ void UVoxelChunk::SetRequestedLODLevel(int InLODLevel)
 
 void UVoxelChunk::Sculpt(const FVector& ImpactPoint, float Radius)
 {
-	if (ChunkInfo.CellNum <= 0 || ChunkInfo.CellSize <= 0)
+	if (ChunkInfo.CellNum <= 0 || ChunkInfo.CellSize <= 0 || ChunkDensityData.Num() == 0)
                 return;
 
         const FVector ChunkCenter = GetComponentLocation();
@@ -65,12 +145,17 @@ void UVoxelChunk::Sculpt(const FVector& ImpactPoint, float Radius)
         const FVector ChunkMin = ChunkCenter - ChunkExtent;
         const FVector ChunkMax = ChunkCenter + ChunkExtent;
 
+        // Apron 꼭짓점도 이웃 Chunk와 같은 값을 유지하도록 범위를 넓혀서 검사
+        const int32 Apron = ChunkInfo.Apron;
+        const FVector ApronMin = ChunkMin - FVector(Apron * ChunkInfo.CellSize);
+        const FVector ApronMax = ChunkMax + FVector(Apron * ChunkInfo.CellSize);
+
         const FVector SphereMin = FVector(ImpactPoint) - FVector(Radius);
         const FVector SphereMax = FVector(ImpactPoint) + FVector(Radius);
 
-        if (SphereMax.X < ChunkMin.X || SphereMin.X > ChunkMax.X ||
-            SphereMax.Y < ChunkMin.Y || SphereMin.Y > ChunkMax.Y ||
-            SphereMax.Z < ChunkMin.Z || SphereMin.Z > ChunkMax.Z)
+        if (SphereMax.X < ApronMin.X || SphereMin.X > ApronMax.X ||
+            SphereMax.Y < ApronMin.Y || SphereMin.Y > ApronMax.Y ||
+            SphereMax.Z < ApronMin.Z || SphereMin.Z > ApronMax.Z)
         {
                 return;
         }
@@ -80,22 +165,22 @@ void UVoxelChunk::Sculpt(const FVector& ImpactPoint, float Radius)
         auto ToMinIndex = [&](float Value, float MinBound) -> int32
         {
                 const float Normalized = (Value - MinBound) / CellSize;
-                return FMath::Clamp(FMath::FloorToInt(Normalized), 0, ChunkInfo.CellNum);
+                return FMath::Clamp(FMath::FloorToInt(Normalized), -Apron, ChunkInfo.CellNum + Apron);
         };
 
         auto ToMaxIndex = [&](float Value, float MinBound) -> int32
         {
                 const float Normalized = (Value - MinBound) / CellSize;
-                return FMath::Clamp(FMath::CeilToInt(Normalized), 0, ChunkInfo.CellNum);
+                return FMath::Clamp(FMath::CeilToInt(Normalized), -Apron, ChunkInfo.CellNum + Apron);
         };
 
-        const int32 StartX = ToMinIndex(FMath::Max(SphereMin.X, ChunkMin.X), ChunkMin.X);
-        const int32 StartY = ToMinIndex(FMath::Max(SphereMin.Y, ChunkMin.Y), ChunkMin.Y);
-        const int32 StartZ = ToMinIndex(FMath::Max(SphereMin.Z, ChunkMin.Z), ChunkMin.Z);
+        const int32 StartX = ToMinIndex(FMath::Max(SphereMin.X, ApronMin.X), ChunkMin.X);
+        const int32 StartY = ToMinIndex(FMath::Max(SphereMin.Y, ApronMin.Y), ChunkMin.Y);
+        const int32 StartZ = ToMinIndex(FMath::Max(SphereMin.Z, ApronMin.Z), ChunkMin.Z);
 
-        const int32 EndX = ToMaxIndex(FMath::Min(SphereMax.X, ChunkMax.X), ChunkMin.X);
-        const int32 EndY = ToMaxIndex(FMath::Min(SphereMax.Y, ChunkMax.Y), ChunkMin.Y);
-        const int32 EndZ = ToMaxIndex(FMath::Min(SphereMax.Z, ChunkMax.Z), ChunkMin.Z);
+        const int32 EndX = ToMaxIndex(FMath::Min(SphereMax.X, ApronMax.X), ChunkMin.X);
+        const int32 EndY = ToMaxIndex(FMath::Min(SphereMax.Y, ApronMax.Y), ChunkMin.Y);
+        const int32 EndZ = ToMaxIndex(FMath::Min(SphereMax.Z, ApronMax.Z), ChunkMin.Z);
 
         if (StartX > EndX || StartY > EndY || StartZ > EndZ)
                 return;
@@ -103,37 +188,242 @@ void UVoxelChunk::Sculpt(const FVector& ImpactPoint, float Radius)
         const FVector SphereCenter(ImpactPoint);
         const float RadiusSquared = Radius * Radius;
 
-        for (int32 z = StartZ; z <= EndZ; ++z)
+        // Mesh 생성 동안에는 Query를 막지 않도록 Density 수정 구간만 잠금
+        DensityLock.WriteLock();
+
+        if (!BrickMinMax.IsValid())
+        {
+                VoxelHelper::BuildBrickMinMax(ChunkInfo, ChunkDensityData, BrickMinMax);
+        }
+
+        // Brush가 닿지 않거나, 닿더라도 현재 값보다 낮출 수 없는 Brick은 통째로 건너뜀
+        bool bChanged = false;
+        const int32 LastBrick = BrickMinMax.BrickNum - 1;
+        for (int32 Bz = BrickMinMax.CornerToBrick(StartZ); Bz <= BrickMinMax.CornerToBrick(EndZ); ++Bz)
+        for (int32 By = BrickMinMax.CornerToBrick(StartY); By <= BrickMinMax.CornerToBrick(EndY); ++By)
+        for (int32 Bx = BrickMinMax.CornerToBrick(StartX); Bx <= BrickMinMax.CornerToBrick(EndX); ++Bx)
         {
-                for (int32 y = StartY; y <= EndY; ++y)
+                int32 BrickMinX, BrickMaxX, BrickMinY, BrickMaxY, BrickMinZ, BrickMaxZ;
+                VoxelHelper::GetBrickCornerRange(ChunkInfo, Bx, BrickMinX, BrickMaxX);
+                VoxelHelper::GetBrickCornerRange(ChunkInfo, By, BrickMinY, BrickMaxY);
+                VoxelHelper::GetBrickCornerRange(ChunkInfo, Bz, BrickMinZ, BrickMaxZ);
+
+                const FBox BrickBox(ChunkMin + FVector(BrickMinX, BrickMinY, BrickMinZ) * CellSize,
+                        ChunkMin + FVector(BrickMaxX, BrickMaxY, BrickMaxZ) * CellSize);
+                const float MinDistance = FMath::Sqrt(BrickBox.ComputeSquaredDistanceToPoint(SphereCenter));
+                if (MinDistance > Radius || BrickMinMax.Max[BrickMinMax.GetBrickIndex(Bx, By, Bz)] <= MinDistance - Radius)
+                        continue;
+
+                // Brick 경계 꼭짓점은 위쪽 Brick에서만 처리
+                const int32 LoopEndX = FMath::Min(EndX, Bx == LastBrick ? BrickMaxX : BrickMaxX - 1);
+                const int32 LoopEndY = FMath::Min(EndY, By == LastBrick ? BrickMaxY : BrickMaxY - 1);
+                const int32 LoopEndZ = FMath::Min(EndZ, Bz == LastBrick ? BrickMaxZ : BrickMaxZ - 1);
+
+                for (int32 z = FMath::Max(StartZ, BrickMinZ); z <= LoopEndZ; ++z)
                 {
-                        for (int32 x = StartX; x <= EndX; ++x)
+                        for (int32 y = FMath::Max(StartY, BrickMinY); y <= LoopEndY; ++y)
                         {
-                                const int32 VertexIndex = VoxelHelper::GetIndex(x, y, z, ChunkInfo.CellNum);
-                                FVector VertexPosition = ChunkMin + FVector(x, y, z) * CellSize;
-
-                                const float DistanceSquared = FVector::DistSquared(VertexPosition, SphereCenter);
-                                if (DistanceSquared > RadiusSquared)
-                                        continue;
-
-                                const float Distance = FMath::Sqrt(DistanceSquared);
-                                const float TargetDensity = Distance - Radius;
-                        		float& CurrentDensity = ChunkDensityData[VertexIndex].Density;
-                        		const float NewDensity = FMath::Min(CurrentDensity, TargetDensity);
-                        		if (!FMath::IsNearlyEqual(CurrentDensity, NewDensity))
-                        		{
-                        			CurrentDensity = NewDensity;
-                        			if (OwningManager)
-                        			{
-                        				OwningManager->RecordSculptedDensity(ChunkInfo, x, y, z, CurrentDensity);
-                        			}
-                        		}
+                                for (int32 x = FMath::Max(StartX, BrickMinX); x <= LoopEndX; ++x)
+                                {
+                                        const int32 VertexIndex = VoxelHelper::GetIndex(x, y, z, ChunkInfo);
+                                        FVector VertexPosition = ChunkMin + FVector(x, y, z) * CellSize;
+
+                                        const float DistanceSquared = FVector::DistSquared(VertexPosition, SphereCenter);
+                                        if (DistanceSquared > RadiusSquared)
+                                                continue;
+
+                                        const float Distance = FMath::Sqrt(DistanceSquared);
+                                        const float TargetDensity = Distance - Radius;
+                                        float& CurrentDensity = ChunkDensityData[VertexIndex].Density;
+                                        const float NewDensity = FMath::Min(CurrentDensity, TargetDensity);
+                                        if (!FMath::IsNearlyEqual(CurrentDensity, NewDensity))
+                                        {
+                                                CurrentDensity = NewDensity;
+                                                bChanged = true;
+                                                if (OwningManager)
+                                                {
+                                                        OwningManager->RecordSculptedDensity(ChunkInfo, x, y, z, CurrentDensity);
+                                                }
+                                        }
+                                }
                         }
                 }
         }
 
-        CachedMeshData = MarchingCubeMeshGenerator::GenerateChunkMesh(ChunkInfo, ChunkDensityData);
-        UpdateMesh(CachedMeshData);
+        if (bChanged)
+        {
+                VoxelHelper::UpdateBrickMinMax(ChunkInfo, ChunkDensityData, FIntVector(StartX, StartY, StartZ), FIntVector(EndX, EndY, EndZ), BrickMinMax);
+        }
+
+        DensityLock.WriteUnlock();
+
+        // 바뀐 꼭짓점이 없으면 Mesh를 다시 만들 필요 없음
+        if (!bChanged)
+                return;
+
+        RebuildSculptedMesh();
+}
+
+void UVoxelChunk::ApplyDensityOverrides(TConstArrayView<TPair<int32, FFloat16>> Overrides)
+{
+	bool bChanged = false;
+	{
+		FWriteScopeLock WriteLock(DensityLock);
+		for (const TPair<int32, FFloat16>& Override : Overrides)
+		{
+			if (!ChunkDensityData.IsValidIndex(Override.Key))
+				continue;
+
+			float& CurrentDensity = ChunkDensityData[Override.Key].Density;
+			const float NewDensity = FMath::Min(CurrentDensity, static_cast<float>(Override.Value));
+			if (!FMath::IsNearlyEqual(CurrentDensity, NewDensity))
+			{
+				CurrentDensity = NewDensity;
+				bChanged = true;
+			}
+		}
+
+		if (bChanged)
+		{
+			VoxelHelper::BuildBrickMinMax(ChunkInfo, ChunkDensityData, BrickMinMax);
+		}
+	}
+
+	if (bChanged)
+	{
+		RebuildSculptedMesh();
+	}
+}
+
+void UVoxelChunk::RebuildSculptedMesh()
+{
+	if (bRenderFree)
+	{
+		MarkCollisionDirty();
+		return;
+	}
+
+	VoxelMesher::GenerateChunkMesh(ChunkInfo, ChunkDensityData, CachedMeshData, &BrickMinMax);
+	VoxelMeshSimplifier::Simplify(CachedMeshData, ChunkInfo.TriangleBudget);
+	bMeshDataReleased = false;
+	UpdateMesh(CachedMeshData);
+	UpdateMemoryStats();
+	MarkCollisionDirty();
+	if (OwningManager)
+	{
+		OwningManager->NotifyChunkMeshChanged(this);
+	}
+}
+
+void UVoxelChunk::SetCollisionActive(bool bActive)
+{
+	if (bCollisionActive == bActive)
+		return;
+
+	bCollisionActive = bActive;
+	if (bCollisionActive)
+	{
+		MarkCollisionDirty();
+		return;
+	}
+
+	// 반경 밖으로 나가면 충돌을 끄고 Collision 전용 Mesh도 해제
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	CollisionMeshData = FVoxelData();
+	CollisionMeshLODLevel = 0;
+	bCollisionDirty = false;
+	UpdateMemoryStats();
+}
+
+void UVoxelChunk::MarkCollisionDirty()
+{
+	if (!bCollisionActive)
+		return;
+
+	// 연속으로 파는 동안에는 처음 Dirty가 된 시간과 마지막 편집 시간을 같이 기록해서 Cooking을 모아서 처리
+	const double Now = FPlatformTime::Seconds();
+	if (!bCollisionDirty)
+	{
+		bCollisionDirty = true;
+		FirstCollisionDirtyTime = Now;
+	}
+	LastCollisionDirtyTime = Now;
+
+	if (OwningManager)
+	{
+		OwningManager->RequestCollisionCook(this);
+	}
+}
+
+void UVoxelChunk::CookCollision(int32 CollisionLODLevel)
+{
+	VOXEL_SCOPE_STAGE(Collision);
+
+	if (!bCollisionActive)
+		return;
+
+	// Render Mesh보다 거친 LOD로 충돌을 만들 때만 별도의 Mesh 생성, Render-Free면 Render Mesh가 없으므로 항상 생성
+	const int32 TargetLODLevel = bRenderFree ? FMath::Max(CollisionLODLevel, 1) : FMath::Max(CollisionLODLevel, CurrentLODLevel);
+	if ((bRenderFree || TargetLODLevel != CurrentLODLevel) && ChunkDensityData.Num() > 0)
+	{
+		VoxelMesher::GenerateChunkMesh(MakeChunkSettingInfoForLOD(TargetLODLevel), ChunkDensityData, CollisionMeshData, &BrickMinMax);
+		CollisionMeshLODLevel = TargetLODLevel;
+
+		// 충돌에는 위치와 Index만 필요
+		CollisionMeshData.Normals.Empty();
+		CollisionMeshData.Colors.Empty();
+	}
+	else
+	{
+		CollisionMeshData = FVoxelData();
+		CollisionMeshLODLevel = 0;
+
+		// 메모리 예산 때문에 해제했던 Render LOD Mesh를 Collision Source로 다시 사용
+		if (bMeshDataReleased)
+		{
+			CopyMeshData(CachedMeshData);
+			bMeshDataReleased = false;
+		}
+	}
+
+	bCollisionDirty = false;
+	UpdateMemoryStats();
+	SetCollisionEnabled(GetCollisionSource().Triangles.Num() > 0 ? ECollisionEnabled::QueryAndPhysics : ECollisionEnabled::NoCollision);
+	UpdateCollision(false);
+}
+
+bool UVoxelChunk::GetPhysicsTriMeshData(FTriMeshCollisionData* CollisionData, bool InUseAllTriData)
+{
+	const FVoxelData& Source = GetCollisionSource();
+	if (Source.Triangles.Num() == 0)
+		return false;
+
+	CollisionData->Vertices.Reserve(Source.Vertices.Num());
+	for (const FVector& Vertex : Source.Vertices)
+	{
+		CollisionData->Vertices.Add(FVector3f(Vertex));
+	}
+
+	CollisionData->Indices.Reserve(Source.Triangles.Num() / 3);
+	CollisionData->MaterialIndices.Reserve(Source.Triangles.Num() / 3);
+	for (int32 i = 0; i + 2 < Source.Triangles.Num(); i += 3)
+	{
+		FTriIndices& Triangle = CollisionData->Indices.AddDefaulted_GetRef();
+		Triangle.v0 = Source.Triangles[i];
+		Triangle.v1 = Source.Triangles[i + 1];
+		Triangle.v2 = Source.Triangles[i + 2];
+		CollisionData->MaterialIndices.Add(0);
+	}
+
+	CollisionData->bFlipNormals = true;
+	CollisionData->bDeformableMesh = true;
+	CollisionData->bFastCook = true;
+	return true;
+}
+
+bool UVoxelChunk::ContainsPhysicsTriMeshData(bool InUseAllTriData) const
+{
+	return bCollisionActive && GetCollisionSource().Triangles.Num() > 0;
 }
 
 // Called when the game starts
@@ -147,12 +437,150 @@ void UVoxelChunk::OnRegister()
 	Super::OnRegister();
 
 	SetCollisionProfileName(TEXT("Dig"));
-	SetComplexAsSimpleCollisionEnabled(true, true);
+	// 충돌은 Manager가 Pawn 주변 Chunk만 예산에 맞춰 Cooking
+	SetComplexAsSimpleCollisionEnabled(true, false);
+	SetDeferredCollisionUpdatesEnabled(true, false);
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	bUseAsyncCooking = true;
 	SetMobility(EComponentMobility::Movable);
 	SetGenerateOverlapEvents(true);
 }
 
+void UVoxelChunk::SetRenderFree()
+{
+	bRenderFree = true;
+	SetVisibility(false);
+	SetComponentTickEnabled(false);
+
+	CachedMeshData = FVoxelData();
+	GetDynamicMesh()->Reset();
+	UpdateMemoryStats();
+}
+
+void UVoxelChunk::ReleaseDensityData()
+{
+	{
+		FWriteScopeLock WriteLock(DensityLock);
+		ChunkDensityData.Empty();
+		BrickMinMax = FVoxelBrickMinMax();
+	}
+	bDensityReleased = true;
+
+	CollisionMeshData = FVoxelData();
+	CollisionMeshLODLevel = 0;
+	UpdateMemoryStats();
+}
+
+void UVoxelChunk::ReleaseMeshData()
+{
+	if (bRenderFree || bMeshDataReleased)
+		return;
+
+	CachedMeshData = FVoxelData();
+	bMeshDataReleased = true;
+	UpdateMemoryStats();
+}
+
+void UVoxelChunk::CopyMeshData(FVoxelData& OutMeshData) const
+{
+	if (!bMeshDataReleased)
+	{
+		OutMeshData = CachedMeshData;
+		return;
+	}
+
+	OutMeshData = FVoxelData();
+	ProcessMesh([&OutMeshData](const FDynamicMesh3& Mesh)
+	{
+		// UpdateMesh가 정점을 순서대로 추가하므로 ID가 그대로 Index, 아니면 압축된 Index로 변환
+		TArray<int32> VertexToIndex;
+		VertexToIndex.SetNumUninitialized(Mesh.MaxVertexID());
+		OutMeshData.Vertices.Reserve(Mesh.VertexCount());
+		OutMeshData.Normals.Reserve(Mesh.HasVertexNormals() ? Mesh.VertexCount() : 0);
+		for (const int32 VertexID : Mesh.VertexIndicesItr())
+		{
+			VertexToIndex[VertexID] = OutMeshData.Vertices.Add(Mesh.GetVertex(VertexID));
+			if (Mesh.HasVertexNormals())
+			{
+				OutMeshData.Normals.Add(FVector(Mesh.GetVertexNormal(VertexID)));
+			}
+		}
+
+		OutMeshData.Triangles.Reserve(Mesh.TriangleCount() * 3);
+		for (const int32 TriangleID : Mesh.TriangleIndicesItr())
+		{
+			const UE::Geometry::FIndex3i Triangle = Mesh.GetTriangle(TriangleID);
+			OutMeshData.Triangles.Add(VertexToIndex[Triangle.A]);
+			OutMeshData.Triangles.Add(VertexToIndex[Triangle.B]);
+			OutMeshData.Triangles.Add(VertexToIndex[Triangle.C]);
+		}
+	});
+}
+
+int64 UVoxelChunk::EstimateRenderMeshBytes() const
+{
+	if (bRenderFree)
+		return 0;
+
+	int64 Bytes = 0;
+	ProcessMesh([&Bytes](const FDynamicMesh3& Mesh)
+	{
+		Bytes = EstimateDynamicMeshBytes(Mesh);
+	});
+	return Bytes;
+}
+
+int64 UVoxelChunk::EstimateDynamicMeshBytes(const UE::Geometry::FDynamicMesh3& Mesh)
+{
+	// 정점 : 위치(double) + Normal + RefCount + Edge 목록, 삼각형 : 정점 / Edge Index + RefCount, Edge : 정점 / 삼각형 Index + RefCount
+	constexpr int64 BytesPerVertex = sizeof(FVector3d) + sizeof(FVector3f) + sizeof(int32) + 6 * sizeof(int32);
+	constexpr int64 BytesPerTriangle = 2 * sizeof(UE::Geometry::FIndex3i) + sizeof(int32);
+	constexpr int64 BytesPerEdge = 2 * sizeof(UE::Geometry::FIndex2i) + sizeof(int32);
+
+	return Mesh.MaxVertexID() * BytesPerVertex + Mesh.MaxTriangleID() * BytesPerTriangle + Mesh.MaxEdgeID() * BytesPerEdge;
+}
+
+void UVoxelChunk::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	DEC_MEMORY_STAT_BY(STAT_VoxelDensityMemory, AccountedMemory.DensityBytes);
+	DEC_MEMORY_STAT_BY(STAT_VoxelMeshMemory, AccountedMemory.MeshDataBytes);
+	DEC_MEMORY_STAT_BY(STAT_VoxelCollisionMemory, AccountedMemory.CollisionBytes);
+	DEC_MEMORY_STAT_BY(STAT_VoxelRenderMeshMemory, AccountedMemory.RenderMeshBytes);
+	if (OwningManager)
+	{
+		OwningManager->AddAccountedMemory(-AccountedMemory.GetTotal());
+	}
+	AccountedMemory = FVoxelChunkMemory();
+
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+}
+
+void UVoxelChunk::UpdateMemoryStats()
+{
+	auto GetMeshBytes = [](const FVoxelData& MeshData) -> int64
+	{
+		return MeshData.Vertices.GetAllocatedSize() + MeshData.Normals.GetAllocatedSize()
+			+ MeshData.Colors.GetAllocatedSize() + MeshData.Triangles.GetAllocatedSize();
+	};
+
+	FVoxelChunkMemory Memory;
+	Memory.DensityBytes = ChunkDensityData.GetAllocatedSize() + BrickMinMax.Min.GetAllocatedSize() + BrickMinMax.Max.GetAllocatedSize();
+	Memory.MeshDataBytes = GetMeshBytes(CachedMeshData);
+	Memory.CollisionBytes = GetMeshBytes(CollisionMeshData);
+	Memory.RenderMeshBytes = EstimateRenderMeshBytes();
+
+	// 이전에 기록한 크기와의 차이만 반영
+	INC_MEMORY_STAT_BY(STAT_VoxelDensityMemory, Memory.DensityBytes - AccountedMemory.DensityBytes);
+	INC_MEMORY_STAT_BY(STAT_VoxelMeshMemory, Memory.MeshDataBytes - AccountedMemory.MeshDataBytes);
+	INC_MEMORY_STAT_BY(STAT_VoxelCollisionMemory, Memory.CollisionBytes - AccountedMemory.CollisionBytes);
+	INC_MEMORY_STAT_BY(STAT_VoxelRenderMeshMemory, Memory.RenderMeshBytes - AccountedMemory.RenderMeshBytes);
+	if (OwningManager)
+	{
+		OwningManager->AddAccountedMemory(Memory.GetTotal() - AccountedMemory.GetTotal());
+	}
+	AccountedMemory = Memory;
+}
+
 // Called every frame
 void UVoxelChunk::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
@@ -163,6 +591,8 @@ void UVoxelChunk::TickComponent(float DeltaTime, ELevelTick TickType, FActorComp
 
 void UVoxelChunk::UpdateMesh(const FVoxelData& VoxelMeshData)
 {
+	VOXEL_SCOPE_STAGE(MeshApply);
+
 	// 삼각형 데이터가 없으면 메시와 충돌을 초기화한 뒤 종료
 	if (VoxelMeshData.Vertices.Num() == 0 || VoxelMeshData.Triangles.Num() == 0)
 	{
@@ -182,10 +612,15 @@ void UVoxelChunk::UpdateMesh(const FVoxelData& VoxelMeshData)
 		TArray<int32> VIDs;
 		VIDs.Reserve(VoxelMeshData.Vertices.Num());
 
-		// 정점 추가
+		// 정점 추가 (Mesher에서 Density Gradient로 계산한 Normal 사용)
+		const bool bHasNormals = VoxelMeshData.Normals.Num() == VoxelMeshData.Vertices.Num();
 		for (int i = 0; i < VoxelMeshData.Vertices.Num(); i++)
 		{
 			int32 ID = EditMesh.AppendVertex(VoxelMeshData.Vertices[i]);
+			if (bHasNormals)
+			{
+				EditMesh.SetVertexNormal(ID, FVector3f(VoxelMeshData.Normals[i]));
+			}
 			VIDs.Add(ID);
 		}
 
@@ -209,36 +644,316 @@ void UVoxelChunk::UpdateMesh(const FVoxelData& VoxelMeshData)
 			// Mappings.CellToVertices[Cell].AddUnique(T2);
 		}
 
-		// 노멀 재계산
-		UE::Geometry::FMeshNormals::QuickComputeVertexNormals(EditMesh);
+		// Mesher Normal이 없을 때만 삼각형 기준으로 재계산
+		if (!bHasNormals)
+		{
+			UE::Geometry::FMeshNormals::QuickComputeVertexNormals(EditMesh);
+		}
 	});
 	
 	//SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
 	NotifyMeshUpdated();
 }
 
-void UVoxelChunk::GenerateChunkDensityData(const FChunkSettingInfo& Info, TArray<FVertexDensity>& OutDensityData, UVoxelManager* Manager)
+void UVoxelChunk::GenerateChunkDensityData(const FChunkSettingInfo& Info, TArray<FVertexDensity>& OutDensityData, UVoxelManager* Manager,
+	FVoxelDensityBatch* Batch)
 {
-	OutDensityData.SetNum((Info.CellNum+1) * (Info.CellNum+1) * (Info.CellNum+1));
-	
-	for (int z=0; z < Info.CellNum + 1; z += 1)
+	VOXEL_SCOPE_STAGE(GenerateDensity);
+
+	// 구운 Planet이 있으면 절차적 계산 대신 Memory Map된 파일에서 읽음
+	const TSharedPtr<const FVoxelCookedPlanet, ESPMode::ThreadSafe> Cooked = Manager ? Manager->GetCookedPlanet() : TSharedPtr<const FVoxelCookedPlanet, ESPMode::ThreadSafe>();
+	if (Cooked && Cooked->LoadDensity(Info, OutDensityData))
 	{
-		for (int y=0; y < Info.CellNum + 1; y += 1)
+		if (Batch)
 		{
-			for (int x=0; x < Info.CellNum + 1; x += 1)
+			Batch->SkipChunk(Info.ChunkIndex);
+		}
+		Manager->ApplySculptedDensityOverrides(Info, OutDensityData);
+		return;
+	}
+
+	OutDensityData.SetNum(VoxelHelper::GetDensityDataNum(Info), EAllowShrinking::No);
+
+	const int32 Apron = Info.Apron;
+	const int32 MinCorner = -Apron;
+	const int32 MaxCorner = Info.CellNum + Apron;
+
+	// 같은 Batch에서 먼저 생성된 이웃 Chunk와 겹치는 영역은 복사해서 중복 계산을 피함
+	TBitArray<> Filled;
+	if (Batch)
+	{
+		TArray<TPair<FIntVector, FVoxelDensityBatch::FDensitySnapshot>> Neighbors;
+		Batch->BeginChunk(Info.ChunkIndex, Neighbors);
+
+		if (Neighbors.Num() > 0)
+		{
+			Filled.Init(false, OutDensityData.Num());
+		}
+
+		for (const TPair<FIntVector, FVoxelDensityBatch::FDensitySnapshot>& Neighbor : Neighbors)
+		{
+			const FIntVector& Offset = Neighbor.Key;
+			const TArray<float>& NeighborDensity = *Neighbor.Value;
+			if (NeighborDensity.Num() != OutDensityData.Num())
+				continue;
+
+			// 이웃 방향 축은 경계면 기준 Apron 두께만큼만 겹침
+			auto GetRange = [&](int32 Axis, int32& OutMin, int32& OutMax)
 			{
+				OutMin = Axis > 0 ? Info.CellNum - Apron : MinCorner;
+				OutMax = Axis < 0 ? Apron : MaxCorner;
+			};
+
+			int32 MinX, MaxX, MinY, MaxY, MinZ, MaxZ;
+			GetRange(Offset.X, MinX, MaxX);
+			GetRange(Offset.Y, MinY, MaxY);
+			GetRange(Offset.Z, MinZ, MaxZ);
+
+			const FIntVector NeighborShift = Offset * Info.CellNum;
+			for (int z = MinZ; z <= MaxZ; z += 1)
+			{
+				for (int y = MinY; y <= MaxY; y += 1)
+				{
+					for (int x = MinX; x <= MaxX; x += 1)
+					{
+						const int32 Index = VoxelHelper::GetIndex(x, y, z, Info);
+						OutDensityData[Index].Density = NeighborDensity[VoxelHelper::GetIndex(
+							x - NeighborShift.X, y - NeighborShift.Y, z - NeighborShift.Z, Info)];
+						Filled[Index] = true;
+					}
+				}
+			}
+		}
+	}
+
+	// 이웃 Chunk와 맞닿는 Apron 꼭짓점까지 함께 계산
+	for (int z = MinCorner; z <= MaxCorner; z += 1)
+	{
+		for (int y = MinCorner; y <= MaxCorner; y += 1)
+		{
+			for (int x = MinCorner; x <= MaxCorner; x += 1)
+			{
+				const int32 Index = VoxelHelper::GetIndex(x, y, z, Info);
+				if (Filled.Num() > 0 && Filled[Index])
+					continue;
+
 				FVector Pos = FVector(x, y, z) * Info.CellSize - FVector(Info.ChunkSize) * 0.5f + Info.ChunkPos;
-				OutDensityData[VoxelHelper::GetIndex(x,y,z,Info.CellNum)].Density = CalculateDensity(Pos, Info.VoxelSize * 0.3f);
+				OutDensityData[Index].Density = EvaluateProceduralDensity(Pos, Info.VoxelSize);
 			}
 		}
 	}
 
+	// Sculpt 적용 전의 절차적 Density만 이웃과 공유
+	if (Batch)
+	{
+		Batch->PublishChunk(Info.ChunkIndex, OutDensityData);
+	}
+
 	if (Manager)
 	{
 		Manager->ApplySculptedDensityOverrides(Info, OutDensityData);
 	}
 }
 
+float UVoxelChunk::EvaluateProceduralDensity(const FVector& VoxelLocalPos, int VoxelSize)
+{
+	return CalculateDensity(VoxelLocalPos, VoxelSize * 0.3f);
+}
+
+float UVoxelChunk::SampleDensity(const FVector& LocalCellPos) const
+{
+	const int32 MaxBase = ChunkInfo.CellNum - 1;
+	const int32 X0 = FMath::Clamp(FMath::FloorToInt(LocalCellPos.X), 0, MaxBase);
+	const int32 Y0 = FMath::Clamp(FMath::FloorToInt(LocalCellPos.Y), 0, MaxBase);
+	const int32 Z0 = FMath::Clamp(FMath::FloorToInt(LocalCellPos.Z), 0, MaxBase);
+
+	const float Tx = FMath::Clamp(static_cast<float>(LocalCellPos.X) - X0, 0.0f, 1.0f);
+	const float Ty = FMath::Clamp(static_cast<float>(LocalCellPos.Y) - Y0, 0.0f, 1.0f);
+	const float Tz = FMath::Clamp(static_cast<float>(LocalCellPos.Z) - Z0, 0.0f, 1.0f);
+
+	auto Corner = [&](int32 Dx, int32 Dy, int32 Dz) -> float
+	{
+		return ChunkDensityData[VoxelHelper::GetIndex(X0 + Dx, Y0 + Dy, Z0 + Dz, ChunkInfo)].Density;
+	};
+
+	const float C00 = FMath::Lerp(Corner(0, 0, 0), Corner(1, 0, 0), Tx);
+	const float C10 = FMath::Lerp(Corner(0, 1, 0), Corner(1, 1, 0), Tx);
+	const float C01 = FMath::Lerp(Corner(0, 0, 1), Corner(1, 0, 1), Tx);
+	const float C11 = FMath::Lerp(Corner(0, 1, 1), Corner(1, 1, 1), Tx);
+
+	return FMath::Lerp(FMath::Lerp(C00, C10, Ty), FMath::Lerp(C01, C11, Ty), Tz);
+}
+
+void UVoxelChunk::SampleDensityAndGradient(const FVector& LocalCellPos, FVoxelDensitySample& OutSample) const
+{
+	const int32 MaxBase = ChunkInfo.CellNum - 1;
+	const int32 X0 = FMath::Clamp(FMath::FloorToInt(LocalCellPos.X), 0, MaxBase);
+	const int32 Y0 = FMath::Clamp(FMath::FloorToInt(LocalCellPos.Y), 0, MaxBase);
+	const int32 Z0 = FMath::Clamp(FMath::FloorToInt(LocalCellPos.Z), 0, MaxBase);
+
+	const float Tx = FMath::Clamp(static_cast<float>(LocalCellPos.X) - X0, 0.0f, 1.0f);
+	const float Ty = FMath::Clamp(static_cast<float>(LocalCellPos.Y) - Y0, 0.0f, 1.0f);
+	const float Tz = FMath::Clamp(static_cast<float>(LocalCellPos.Z) - Z0, 0.0f, 1.0f);
+
+	// 8개 꼭짓점을 한 번만 읽어서 Density와 세 축 편미분을 같이 계산
+	float C[2][2][2];
+	for (int32 Dz = 0; Dz < 2; ++Dz)
+		for (int32 Dy = 0; Dy < 2; ++Dy)
+			for (int32 Dx = 0; Dx < 2; ++Dx)
+			{
+				C[Dz][Dy][Dx] = ChunkDensityData[VoxelHelper::GetIndex(X0 + Dx, Y0 + Dy, Z0 + Dz, ChunkInfo)].Density;
+			}
+
+	const float C00 = FMath::Lerp(C[0][0][0], C[0][0][1], Tx);
+	const float C10 = FMath::Lerp(C[0][1][0], C[0][1][1], Tx);
+	const float C01 = FMath::Lerp(C[1][0][0], C[1][0][1], Tx);
+	const float C11 = FMath::Lerp(C[1][1][0], C[1][1][1], Tx);
+	const float C0 = FMath::Lerp(C00, C10, Ty);
+	const float C1 = FMath::Lerp(C01, C11, Ty);
+
+	const float DX00 = C[0][0][1] - C[0][0][0];
+	const float DX10 = C[0][1][1] - C[0][1][0];
+	const float DX01 = C[1][0][1] - C[1][0][0];
+	const float DX11 = C[1][1][1] - C[1][1][0];
+
+	const float InvCellSize = 1.0f / ChunkInfo.CellSize;
+	OutSample.Density = FMath::Lerp(C0, C1, Tz);
+	OutSample.Gradient = FVector(
+		FMath::Lerp(FMath::Lerp(DX00, DX10, Ty), FMath::Lerp(DX01, DX11, Ty), Tz),
+		FMath::Lerp(C10 - C00, C11 - C01, Tz),
+		C1 - C0) * InvCellSize;
+
+	const int32 NearestX = X0 + (Tx >= 0.5f ? 1 : 0);
+	const int32 NearestY = Y0 + (Ty >= 0.5f ? 1 : 0);
+	const int32 NearestZ = Z0 + (Tz >= 0.5f ? 1 : 0);
+	OutSample.MaterialId = ChunkDensityData[VoxelHelper::GetIndex(NearestX, NearestY, NearestZ, ChunkInfo)].Id;
+	OutSample.bFromResidentChunk = true;
+}
+
+void UVoxelChunk::SampleDensityAndGradientBatch(TConstArrayView<int32> SampleIndices, TConstArrayView<FVector> GridPositions,
+	const FVector& ChunkGridOffset, TArrayView<FVoxelDensitySample> OutSamples) const
+{
+	// SampleDensityAndGradient와 같은 식, 꼭짓점 Gather와 Material만 Lane별로 처리
+	const VectorRegister4Float Zero = VectorZeroFloat();
+	const VectorRegister4Float One = VectorOneFloat();
+	const VectorRegister4Float MaxBase = VectorSetFloat1(static_cast<float>(ChunkInfo.CellNum - 1));
+	const VectorRegister4Float InvCellSize = VectorSetFloat1(1.0f / ChunkInfo.CellSize);
+
+	for (int32 Start = 0; Start < SampleIndices.Num(); Start += SampleLanes)
+	{
+		VectorRegister4Float X, Y, Z;
+		const int32 LaneCount = LoadSampleLanes(SampleIndices, GridPositions, ChunkGridOffset, Start, X, Y, Z);
+
+		const VectorRegister4Float BaseX = VectorMin(VectorMax(VectorFloor(X), Zero), MaxBase);
+		const VectorRegister4Float BaseY = VectorMin(VectorMax(VectorFloor(Y), Zero), MaxBase);
+		const VectorRegister4Float BaseZ = VectorMin(VectorMax(VectorFloor(Z), Zero), MaxBase);
+		const VectorRegister4Float Tx = VectorMin(VectorMax(VectorSubtract(X, BaseX), Zero), One);
+		const VectorRegister4Float Ty = VectorMin(VectorMax(VectorSubtract(Y, BaseY), Zero), One);
+		const VectorRegister4Float Tz = VectorMin(VectorMax(VectorSubtract(Z, BaseZ), Zero), One);
+
+		alignas(16) float Base[3][SampleLanes];
+		alignas(16) float Frac[3][SampleLanes];
+		VectorStoreAligned(BaseX, Base[0]);
+		VectorStoreAligned(BaseY, Base[1]);
+		VectorStoreAligned(BaseZ, Base[2]);
+		VectorStoreAligned(Tx, Frac[0]);
+		VectorStoreAligned(Ty, Frac[1]);
+		VectorStoreAligned(Tz, Frac[2]);
+
+		// Corner Index = Dx + Dy * 2 + Dz * 4
+		alignas(16) float Corners[8][SampleLanes];
+		for (int32 Lane = 0; Lane < SampleLanes; ++Lane)
+		{
+			const int32 X0 = static_cast<int32>(Base[0][Lane]);
+			const int32 Y0 = static_cast<int32>(Base[1][Lane]);
+			const int32 Z0 = static_cast<int32>(Base[2][Lane]);
+			for (int32 Corner = 0; Corner < 8; ++Corner)
+			{
+				Corners[Corner][Lane] = ChunkDensityData[VoxelHelper::GetIndex(X0 + (Corner & 1), Y0 + ((Corner >> 1) & 1), Z0 + (Corner >> 2), ChunkInfo)].Density;
+			}
+		}
+
+		VectorRegister4Float C[8];
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			C[Corner] = VectorLoadAligned(Corners[Corner]);
+		}
+
+		const VectorRegister4Float C00 = VectorLerp(C[0], C[1], Tx);
+		const VectorRegister4Float C10 = VectorLerp(C[2], C[3], Tx);
+		const VectorRegister4Float C01 = VectorLerp(C[4], C[5], Tx);
+		const VectorRegister4Float C11 = VectorLerp(C[6], C[7], Tx);
+		const VectorRegister4Float C0 = VectorLerp(C00, C10, Ty);
+		const VectorRegister4Float C1 = VectorLerp(C01, C11, Ty);
+
+		const VectorRegister4Float DX0 = VectorLerp(VectorSubtract(C[1], C[0]), VectorSubtract(C[3], C[2]), Ty);
+		const VectorRegister4Float DX1 = VectorLerp(VectorSubtract(C[5], C[4]), VectorSubtract(C[7], C[6]), Ty);
+
+		alignas(16) float Density[SampleLanes];
+		alignas(16) float Gradient[3][SampleLanes];
+		VectorStoreAligned(VectorLerp(C0, C1, Tz), Density);
+		VectorStoreAligned(VectorMultiply(VectorLerp(DX0, DX1, Tz), InvCellSize), Gradient[0]);
+		VectorStoreAligned(VectorMultiply(VectorLerp(VectorSubtract(C10, C00), VectorSubtract(C11, C01), Tz), InvCellSize), Gradient[1]);
+		VectorStoreAligned(VectorMultiply(VectorSubtract(C1, C0), InvCellSize), Gradient[2]);
+
+		for (int32 Lane = 0; Lane < LaneCount; ++Lane)
+		{
+			FVoxelDensitySample& Sample = OutSamples[SampleIndices[Start + Lane]];
+			Sample.Density = Density[Lane];
+			Sample.Gradient = FVector(Gradient[0][Lane], Gradient[1][Lane], Gradient[2][Lane]);
+
+			const int32 NearestX = static_cast<int32>(Base[0][Lane]) + (Frac[0][Lane] >= 0.5f ? 1 : 0);
+			const int32 NearestY = static_cast<int32>(Base[1][Lane]) + (Frac[1][Lane] >= 0.5f ? 1 : 0);
+			const int32 NearestZ = static_cast<int32>(Base[2][Lane]) + (Frac[2][Lane] >= 0.5f ? 1 : 0);
+			Sample.MaterialId = ChunkDensityData[VoxelHelper::GetIndex(NearestX, NearestY, NearestZ, ChunkInfo)].Id;
+			Sample.bFromResidentChunk = true;
+		}
+	}
+}
+
+VectorRegister4Float UVoxelChunk::EvaluateProceduralDensity4(const VectorRegister4Float& X, const VectorRegister4Float& Y, const VectorRegister4Float& Z, int VoxelSize)
+{
+	// CalculateDensity와 같이 반지름은 정수로 자름
+	const VectorRegister4Float Radius = VectorSetFloat1(static_cast<float>(static_cast<int>(VoxelSize * 0.3f)));
+	const VectorRegister4Float LengthSquared = VectorMultiplyAdd(X, X, VectorMultiplyAdd(Y, Y, VectorMultiply(Z, Z)));
+	return VectorSubtract(Radius, VectorSqrt(LengthSquared));
+}
+
+void UVoxelChunk::EvaluateProceduralSamples(TConstArrayView<int32> SampleIndices, TConstArrayView<FVector> Positions, const FVector& Origin,
+	float GradientStep, int VoxelSize, TArrayView<FVoxelDensitySample> OutSamples)
+{
+	const VectorRegister4Float H = VectorSetFloat1(GradientStep);
+	const VectorRegister4Float InvTwoH = VectorSetFloat1(0.5f / GradientStep);
+
+	for (int32 Start = 0; Start < SampleIndices.Num(); Start += SampleLanes)
+	{
+		VectorRegister4Float X, Y, Z;
+		const int32 LaneCount = LoadSampleLanes(SampleIndices, Positions, Origin, Start, X, Y, Z);
+
+		auto Difference = [&](const VectorRegister4Float& PX, const VectorRegister4Float& PY, const VectorRegister4Float& PZ,
+			const VectorRegister4Float& NX, const VectorRegister4Float& NY, const VectorRegister4Float& NZ)
+		{
+			return VectorMultiply(VectorSubtract(EvaluateProceduralDensity4(PX, PY, PZ, VoxelSize), EvaluateProceduralDensity4(NX, NY, NZ, VoxelSize)), InvTwoH);
+		};
+
+		alignas(16) float Density[SampleLanes];
+		alignas(16) float Gradient[3][SampleLanes];
+		VectorStoreAligned(EvaluateProceduralDensity4(X, Y, Z, VoxelSize), Density);
+		VectorStoreAligned(Difference(VectorAdd(X, H), Y, Z, VectorSubtract(X, H), Y, Z), Gradient[0]);
+		VectorStoreAligned(Difference(X, VectorAdd(Y, H), Z, X, VectorSubtract(Y, H), Z), Gradient[1]);
+		VectorStoreAligned(Difference(X, Y, VectorAdd(Z, H), X, Y, VectorSubtract(Z, H)), Gradient[2]);
+
+		for (int32 Lane = 0; Lane < LaneCount; ++Lane)
+		{
+			FVoxelDensitySample& Sample = OutSamples[SampleIndices[Start + Lane]];
+			Sample.Density = Density[Lane];
+			Sample.Gradient = FVector(Gradient[0][Lane], Gradient[1][Lane], Gradient[2][Lane]);
+			Sample.MaterialId = 0;
+			Sample.bFromResidentChunk = false;
+		}
+	}
+}
+
 float UVoxelChunk::CalculateDensity(const FVector& Pos, int Radius)
 {
 	float Distance = Pos.Size();
@@ -6,10 +6,13 @@
 #include "VoxelManager.h"
 #include "Components/DynamicMeshComponent.h"
 #include "Components/SceneComponent.h"
+#include "Math/VectorRegister.h"
 #include "Defines/VoxelStructs.h"
 #include "Planet/Voxel/Defines/VoxelStructs.h"
 #include "VoxelChunk.generated.h"
 
+class FVoxelDensityBatch;
+
 
 /*
  * 용어 정의
@@ -29,12 +32,29 @@ public:
 	// Sets default values for this component's properties
 	UVoxelChunk();
 
-	void GenerateChunkMesh(const FChunkSettingInfo& Info, FChunkBuildResult&& Result);
-	static FChunkBuildResult GenerateChunkData(const FChunkSettingInfo& Info, UVoxelManager* Manager);
+	// Result의 데이터를 복사 없이 Chunk 데이터와 Swap, 호출 후 Result에는 이전 데이터가 남으므로 Pool에 반환해서 재사용
+	void GenerateChunkMesh(const FChunkSettingInfo& Info, FChunkBuildResult& Result);
+	// OutResult의 기존 할당 용량을 재사용해서 Density와 Mesh를 채움
+	static void GenerateChunkData(const FChunkSettingInfo& Info, UVoxelManager* Manager, FVoxelDensityBatch* Batch, FChunkBuildResult& OutResult);
+	// Manager가 있으면 Sculpt 기록까지 반영
+	static void GenerateChunkDensityData(const FChunkSettingInfo& Info, TArray<FVertexDensity>& OutDensityData, UVoxelManager* Manager,
+		FVoxelDensityBatch* Batch);
+	// 이미 채운 Density(Disk Cache 등)로 Mesh만 생성
+	static void GenerateChunkMeshData(const FChunkSettingInfo& Info, UVoxelManager* Manager, FChunkBuildResult& InOutResult);
 
 	void InitializeChunk(const FChunkSettingInfo& Info);
 	
 	void SetVoxelManager(UVoxelManager* VoxelManager){ OwningManager = VoxelManager; }
+	// Render Mesh를 만들지 않고 Density와 Collision 전용 Mesh만 유지 (Dedicated Server)
+	void SetRenderFree();
+	bool IsRenderFree() const { return bRenderFree; }
+	// 멀어진 Chunk의 Density를 버림, Sculpt 기록은 Manager에 남아 다시 Build할 때 반영됨
+	void ReleaseDensityData();
+	bool IsDensityReleased() const { return bDensityReleased; }
+	// Render Mesh와 중복인 CachedMeshData를 버림, Collision / Cluster에 필요하면 Render Mesh에서 복원
+	void ReleaseMeshData();
+	bool IsMeshDataReleased() const { return bMeshDataReleased; }
+	const FVoxelChunkMemory& GetMemory() const { return AccountedMemory; }
 	UVoxelManager* GetVoxelManager() const {return OwningManager; }
 	int GetRequestedLODLevel() const {return RequestedLODLevel; };
 	int32 GetCurrentLODLevel() const { return CurrentLODLevel; }
@@ -43,12 +63,58 @@ public:
 	void SetRequestedLODLevel(int InLODLevel);
 	
 	void Sculpt(const FVector& ImpactPoint, float radius);;
+	// 네트워크로 받은 Sculpt 기록(꼭짓점 Index -> Density)을 현재 Density와 최소값으로 병합
+	void ApplyDensityOverrides(TConstArrayView<TPair<int32, FFloat16>> Overrides);
+
+	/* Density Query */
+	const FChunkSettingInfo& GetChunkInfo() const { return ChunkInfo; }
+	// CachedMeshData가 해제됐으면 Render Mesh에서 복원해서 복사
+	void CopyMeshData(FVoxelData& OutMeshData) const;
+	bool HasDensityData() const { return ChunkDensityData.Num() > 0; }
+	// LocalCellPos : Chunk 최소 꼭짓점 기준 Cell 단위 좌표 (0 ~ CellNum), 주변 8개 꼭짓점을 삼선형 보간
+	float SampleDensity(const FVector& LocalCellPos) const;
+	// 삼선형 보간 Density와 해석적 Gradient, Material을 한 번에 계산 (호출자가 GetDensityLock()으로 ReadLock 필요)
+	void SampleDensityAndGradient(const FVector& LocalCellPos, FVoxelDensitySample& OutSample) const;
+	// SampleIndices의 샘플을 4개씩 SoA로 묶어서 SIMD로 보간, 결과는 OutSamples[SampleIndex]에 씀 (호출자가 ReadLock 필요)
+	void SampleDensityAndGradientBatch(TConstArrayView<int32> SampleIndices, TConstArrayView<FVector> GridPositions, const FVector& ChunkGridOffset,
+		TArrayView<FVoxelDensitySample> OutSamples) const;
+	FRWLock& GetDensityLock() const { return DensityLock; }
+	// Brick별 Density 최소/최대값, Density와 같이 GetDensityLock()으로 보호됨
+	const FVoxelBrickMinMax& GetBrickMinMax() const { return BrickMinMax; }
+	// Voxel 중심 기준 좌표에서의 절차적 Density (Chunk 데이터가 없을 때 사용)
+	static float EvaluateProceduralDensity(const FVector& VoxelLocalPos, int VoxelSize);
+	// EvaluateProceduralDensity의 4개 동시 계산 버전, 절차적 Density 함수를 바꾸면 같이 바꿔야 함
+	static VectorRegister4Float EvaluateProceduralDensity4(const VectorRegister4Float& X, const VectorRegister4Float& Y, const VectorRegister4Float& Z, int VoxelSize);
+	// Position - Origin 위치의 절차적 Density와 중심 차분 Gradient를 4개씩 SIMD로 계산
+	static void EvaluateProceduralSamples(TConstArrayView<int32> SampleIndices, TConstArrayView<FVector> Positions, const FVector& Origin,
+		float GradientStep, int VoxelSize, TArrayView<FVoxelDensitySample> OutSamples);
+	// 절차적 Density 함수를 바꾸면 올려서 디스크 Cache / Cooked Planet을 무효화
+	static constexpr uint32 ProceduralDensityVersion = 1;
+
+	// FDynamicMesh3의 정점 / 삼각형 / Edge 배열 크기로 추정, Cluster / 시작 Shell Mesh에도 사용
+	static int64 EstimateDynamicMeshBytes(const UE::Geometry::FDynamicMesh3& Mesh);
+
+	/* Collision */
+	void SetCollisionActive(bool bActive);
+	bool IsCollisionActive() const { return bCollisionActive; }
+	bool IsCollisionDirty() const { return bCollisionDirty; }
+	double GetFirstCollisionDirtyTime() const { return FirstCollisionDirtyTime; }
+	double GetLastCollisionDirtyTime() const { return LastCollisionDirtyTime; }
+	void MarkCollisionDirty();
+	void CookCollision(int32 CollisionLODLevel);
+
+	virtual bool GetPhysicsTriMeshData(struct FTriMeshCollisionData* CollisionData, bool InUseAllTriData) override;
+	virtual bool ContainsPhysicsTriMeshData(bool InUseAllTriData) const override;
+
+	// Manager의 Cooking Queue 중복 등록 방지용
+	bool bQueuedForCollisionCook = false;
 	
 
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 	virtual void OnRegister() override;
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
 public:
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
@@ -57,13 +123,33 @@ public:
 private:
 	FVoxelData CachedMeshData;
 	TArray<FVertexDensity> ChunkDensityData;
+	FVoxelBrickMinMax BrickMinMax;
+	// 다른 스레드의 Density Query와 Game Thread의 Density 교체/Sculpt 사이 동기화
+	mutable FRWLock DensityLock;
 	//FVoxelDataMappings Mappings;
 	FChunkSettingInfo ChunkInfo;
 	int32 CurrentLODLevel = 1;
 	int32 RequestedLODLevel = 1;
+	bool bRenderFree = false;
+	bool bDensityReleased = false;
+	bool bMeshDataReleased = false;
+
+	FVoxelData CollisionMeshData; // Render LOD보다 거친 Collision LOD일 때만 사용
+	int32 CollisionMeshLODLevel = 0;
+	bool bCollisionActive = false;
+	bool bCollisionDirty = false;
+	double FirstCollisionDirtyTime = 0.0;
+	double LastCollisionDirtyTime = 0.0;
+	const FVoxelData& GetCollisionSource() const { return CollisionMeshLODLevel > 0 ? CollisionMeshData : CachedMeshData; }
 	
 	void UpdateMesh(const FVoxelData& VoxelMeshData);
-	static void GenerateChunkDensityData(const FChunkSettingInfo& Info, TArray<FVertexDensity>& OutDensityData, UVoxelManager* Manager);
+	// Sculpt로 Density가 바뀐 뒤 Mesh / Collision / Cluster 갱신
+	void RebuildSculptedMesh();
+
+	// stat Voxel 메모리 통계에 반영한 크기
+	void UpdateMemoryStats();
+	FVoxelChunkMemory AccountedMemory;
+	int64 EstimateRenderMeshBytes() const;
 	static float CalculateDensity(const FVector& Pos, int Radius);
 
 	UPROPERTY()
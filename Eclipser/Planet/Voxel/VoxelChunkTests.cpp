@@ -0,0 +1,107 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "VoxelChunk.h"
+#include "Planet/MarchingCube/MarchingCubeMeshGenerator.h"
+#include "Planet/Voxel/Benchmark/VoxelTestHelper.h"
+#include "Planet/Voxel/etc/VoxelDensityBatch.h"
+#include "Planet/Voxel/etc/VoxelHelper.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkDeterminismTest, "Eclipser.Voxel.Chunk.Determinism", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FVoxelChunkDeterminismTest::RunTest(const FString& Parameters)
+{
+	// 같은 입력은 항상 같은 Mesh, Batch로 이웃 Density를 복사해도 직접 계산한 결과와 같아야 함
+	FChunkSettingInfo BaseInfo = VoxelTestHelper::MakeTestInfo(8, 1);
+	BaseInfo.ChunkNum = 2;
+
+	FVoxelDensityBatch Batch;
+	TArray<FChunkSettingInfo> Infos;
+	for (int32 z = 0; z < 2; ++z)
+		for (int32 y = 0; y < 2; ++y)
+			for (int32 x = 0; x < 2; ++x)
+			{
+				FChunkSettingInfo& Info = Infos.Add_GetRef(BaseInfo);
+				Info.ChunkIndex = FIntVector(x, y, z);
+				Info.Calculate();
+				Batch.AddChunk(Info.ChunkIndex);
+			}
+
+	for (const FChunkSettingInfo& Info : Infos)
+	{
+		FChunkBuildResult First;
+		FChunkBuildResult Second;
+		FChunkBuildResult Batched;
+		UVoxelChunk::GenerateChunkData(Info, nullptr, nullptr, First);
+		UVoxelChunk::GenerateChunkData(Info, nullptr, nullptr, Second);
+		UVoxelChunk::GenerateChunkData(Info, nullptr, &Batch, Batched);
+
+		const FString ChunkName = Info.ChunkIndex.ToString();
+		AddErrorIfFalse(First.MeshData.Triangles.Num() > 0, FString::Printf(TEXT("Chunk %s has no surface"), *ChunkName));
+		AddErrorIfFalse(VoxelTestHelper::HashMesh(First.MeshData) == VoxelTestHelper::HashMesh(Second.MeshData),
+			FString::Printf(TEXT("Chunk %s mesh differs between runs"), *ChunkName));
+		AddErrorIfFalse(VoxelTestHelper::HashMesh(First.MeshData) == VoxelTestHelper::HashMesh(Batched.MeshData),
+			FString::Printf(TEXT("Chunk %s batched mesh differs"), *ChunkName));
+
+		for (int32 i = 0; i < First.DensityData.Num(); ++i)
+		{
+			if (!AddErrorIfFalse(First.DensityData[i].Density == Batched.DensityData[i].Density,
+				FString::Printf(TEXT("Chunk %s batched density differs at %d"), *ChunkName, i)))
+				break;
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkDensityLayoutTest, "Eclipser.Voxel.Chunk.DensityLayouts", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FVoxelChunkDensityLayoutTest::RunTest(const FString& Parameters)
+{
+	// Density 배치만 다르고 좌표별 값과 Mesh는 모두 같아야 함 (Tile로 나누어 떨어지지 않는 CellNum 포함)
+	for (const int32 CellNum : { 16, 21 })
+	{
+		FChunkSettingInfo LinearInfo = VoxelTestHelper::MakeTestInfo(CellNum, 1);
+		LinearInfo.ChunkNum = 2;
+		LinearInfo.ChunkIndex = FIntVector(1, 1, 1);
+		LinearInfo.Calculate();
+
+		FChunkSettingInfo TiledInfo = LinearInfo;
+		TiledInfo.DensityLayout = EVoxelDensityLayout::Tiled;
+
+		FChunkBuildResult Linear;
+		FChunkBuildResult Tiled;
+		UVoxelChunk::GenerateChunkData(LinearInfo, nullptr, nullptr, Linear);
+		UVoxelChunk::GenerateChunkData(TiledInfo, nullptr, nullptr, Tiled);
+
+		bool bDensityMatches = true;
+		for (int32 z = -LinearInfo.Apron; z <= CellNum + LinearInfo.Apron && bDensityMatches; ++z)
+			for (int32 y = -LinearInfo.Apron; y <= CellNum + LinearInfo.Apron && bDensityMatches; ++y)
+				for (int32 x = -LinearInfo.Apron; x <= CellNum + LinearInfo.Apron && bDensityMatches; ++x)
+				{
+					bDensityMatches = AddErrorIfFalse(
+						Linear.DensityData[VoxelHelper::GetIndex(x, y, z, LinearInfo)].Density == Tiled.DensityData[VoxelHelper::GetIndex(x, y, z, TiledInfo)].Density,
+						FString::Printf(TEXT("CellNum=%d: tiled density differs at (%d, %d, %d)"), CellNum, x, y, z));
+				}
+
+		for (const int32 LODLevel : { 1, 2, 4, 8 })
+		{
+			LinearInfo.LODLevel = LODLevel;
+			TiledInfo.LODLevel = LODLevel;
+
+			FVoxelData LinearMesh;
+			FVoxelData TiledMesh;
+			MarchingCubeMeshGenerator::GenerateChunkMesh(LinearInfo, Linear.DensityData, LinearMesh, &Linear.BrickMinMax);
+			MarchingCubeMeshGenerator::GenerateChunkMesh(TiledInfo, Tiled.DensityData, TiledMesh, &Tiled.BrickMinMax);
+
+			AddErrorIfFalse(LinearMesh.Triangles.Num() > 0, FString::Printf(TEXT("CellNum=%d LOD=%d: no triangles"), CellNum, LODLevel));
+			AddErrorIfFalse(VoxelTestHelper::HashMesh(LinearMesh) == VoxelTestHelper::HashMesh(TiledMesh),
+				FString::Printf(TEXT("CellNum=%d LOD=%d: tiled mesh differs from linear"), CellNum, LODLevel));
+		}
+	}
+
+	return true;
+}
+
+#endif
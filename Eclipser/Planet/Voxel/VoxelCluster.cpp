@@ -0,0 +1,83 @@
+#include "VoxelCluster.h"
+
+#include "DynamicMesh/MeshNormals.h"
+#include "Planet/Voxel/VoxelChunk.h"
+#include "Planet/Voxel/Defines/VoxelStats.h"
+#include "Planet/Voxel/etc/VoxelHelper.h"
+#include "Planet/Voxel/etc/VoxelMesher.h"
+
+using namespace UE::Geometry;
+
+UVoxelCluster::UVoxelCluster()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UVoxelCluster::BuildClusterMesh(TConstArrayView<FVoxelClusterMemberMesh> Members, FDynamicMesh3& OutMesh)
+{
+	VOXEL_SCOPE_STAGE(ClusterBuild);
+
+	OutMesh.Clear();
+	OutMesh.EnableVertexNormals(FVector3f());
+
+	TArray<int32> VIDs;
+	for (const FVoxelClusterMemberMesh& Member : Members)
+	{
+		const FVoxelData& MeshData = Member.MeshData;
+		const bool bHasNormals = MeshData.Normals.Num() == MeshData.Vertices.Num();
+
+		VIDs.Reset(MeshData.Vertices.Num());
+		for (int32 i = 0; i < MeshData.Vertices.Num(); ++i)
+		{
+			const int32 ID = OutMesh.AppendVertex(MeshData.Vertices[i] + Member.Offset);
+			if (bHasNormals)
+			{
+				OutMesh.SetVertexNormal(ID, FVector3f(MeshData.Normals[i]));
+			}
+			VIDs.Add(ID);
+		}
+
+		// Chunk 경계 정점은 이웃 Chunk와 용접하지 않고 그대로 둠 (Chunk Mesh와 같은 모양 유지)
+		for (int32 i = 0; i + 2 < MeshData.Triangles.Num(); i += 3)
+		{
+			OutMesh.AppendTriangle(VIDs[MeshData.Triangles[i]], VIDs[MeshData.Triangles[i + 1]], VIDs[MeshData.Triangles[i + 2]]);
+		}
+	}
+}
+
+void UVoxelCluster::BuildShellMesh(const FChunkSettingInfo& ShellInfo, FDynamicMesh3& OutMesh)
+{
+	// Sculpt 기록은 Chunk Index 기준이라 Shell에는 적용하지 않음 (시작 직후에는 기록도 없음)
+	TArray<FVertexDensity> DensityData;
+	FVoxelBrickMinMax BrickMinMax;
+	UVoxelChunk::GenerateChunkDensityData(ShellInfo, DensityData, nullptr, nullptr);
+	VoxelHelper::BuildBrickMinMax(ShellInfo, DensityData, BrickMinMax);
+
+	FVoxelClusterMemberMesh Shell;
+	VoxelMesher::GenerateChunkMesh(ShellInfo, DensityData, Shell.MeshData, &BrickMinMax);
+	BuildClusterMesh(MakeArrayView(&Shell, 1), OutMesh);
+}
+
+void UVoxelCluster::ApplyMesh(FDynamicMesh3&& Mesh)
+{
+	VOXEL_SCOPE_STAGE(MeshApply);
+
+	SetMesh(MoveTemp(Mesh));
+}
+
+void UVoxelCluster::ReleaseMesh()
+{
+	GetDynamicMesh()->Reset();
+	NotifyMeshUpdated();
+}
+
+void UVoxelCluster::OnRegister()
+{
+	Super::OnRegister();
+
+	// 충돌은 멤버 Chunk가 담당
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	SetGenerateOverlapEvents(false);
+	SetMobility(EComponentMobility::Movable);
+	SetVisibility(false);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/DynamicMeshComponent.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "Defines/VoxelStructs.h"
+#include "VoxelCluster.generated.h"
+
+class UVoxelChunk;
+
+// Cluster Mesh를 만들 때 Worker로 넘기는 멤버 Chunk Mesh 복사본
+struct FVoxelClusterMemberMesh
+{
+	FVector Offset = FVector::ZeroVector; // Cluster 중심 기준 Chunk 중심 위치
+	FVoxelData MeshData;
+};
+
+struct FVoxelClusterBuildResult
+{
+	FIntVector ClusterIndex = FIntVector::ZeroValue;
+	uint32 Revision = 0;
+	UE::Geometry::FDynamicMesh3 Mesh;
+};
+
+/*
+ * 멀리 있는 Chunk 여러 개(ClusterSize^3)의 Mesh를 하나로 합친 Render 전용 Component
+ * 합쳐진 동안 멤버 Chunk는 숨겨서 Draw Call / Render Proxy 수를 줄이고, 충돌은 멤버 Chunk가 그대로 담당
+ * 시작할 때 Chunk가 만들어지기 전까지 보여주는 거친 Planet Shell에도 사용
+ */
+UCLASS(ClassGroup=(Custom))
+class ECLIPSER_API UVoxelCluster : public UDynamicMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+	UVoxelCluster();
+
+	// Worker Thread에서 호출, 멤버 Mesh를 Offset만큼 옮겨서 하나의 Mesh로 합침
+	static void BuildClusterMesh(TConstArrayView<FVoxelClusterMemberMesh> Members, UE::Geometry::FDynamicMesh3& OutMesh);
+	// Worker Thread에서 호출, 여러 Chunk 영역을 하나의 큰 Chunk로 보고 절차적 Density만으로 거친 Mesh 생성 (시작 시 Shell 용)
+	static void BuildShellMesh(const FChunkSettingInfo& ShellInfo, UE::Geometry::FDynamicMesh3& OutMesh);
+
+	void ApplyMesh(UE::Geometry::FDynamicMesh3&& Mesh);
+	// Split 후 합친 Mesh 메모리 해제
+	void ReleaseMesh();
+
+protected:
+	virtual void OnRegister() override;
+};
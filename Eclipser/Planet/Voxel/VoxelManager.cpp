@@ -2,11 +2,133 @@
 
 #include "VoxelManager.h"
 #include "Planet/Voxel/VoxelChunk.h"
+#include "Planet/Voxel/VoxelNetComponent.h"
+#include "Defines/VoxelStats.h"
 #include "Defines/VoxelStructs.h"
+#include "etc/VoxelBuildResultPool.h"
+#include "etc/VoxelChunkCache.h"
+#include "etc/VoxelCookedPlanet.h"
+#include "etc/VoxelDensityBatch.h"
 #include "etc/VoxelHelper.h"
+#include "etc/VoxelMesher.h"
+#include "Algo/AllOf.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectIterator.h"
 
 
+namespace
+{
+	// Origin에서 시작하는 Extent 크기의 Count^3 격자를 Ray가 [T0, T1] 구간에서 지나는 순서대로 방문 (Amanatides-Woo 3D DDA)
+	// Visitor(격자 Index, 진입 t, 탈출 t)가 true를 반환하면 중단
+	template<typename VisitorType>
+	bool TraverseGrid(const FVector& Start, const FVector& Dir, const FVector& Origin, float Extent, int32 Count,
+		float T0, float T1, VisitorType&& Visitor)
+	{
+		const FVector EntryPoint = Start + Dir * T0;
+		FIntVector Index;
+		FIntVector Step;
+		FVector TMax;
+		FVector TDelta;
+
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const float Normalized = (EntryPoint[Axis] - Origin[Axis]) / Extent;
+			Index[Axis] = FMath::Clamp(FMath::FloorToInt(Normalized), 0, Count - 1);
+
+			if (Dir[Axis] > UE_SMALL_NUMBER)
+			{
+				Step[Axis] = 1;
+				TMax[Axis] = (Origin[Axis] + (Index[Axis] + 1) * Extent - Start[Axis]) / Dir[Axis];
+				TDelta[Axis] = Extent / Dir[Axis];
+			}
+			else if (Dir[Axis] < -UE_SMALL_NUMBER)
+			{
+				Step[Axis] = -1;
+				TMax[Axis] = (Origin[Axis] + Index[Axis] * Extent - Start[Axis]) / Dir[Axis];
+				TDelta[Axis] = -Extent / Dir[Axis];
+			}
+			else
+			{
+				Step[Axis] = 0;
+				TMax[Axis] = TNumericLimits<float>::Max();
+				TDelta[Axis] = TNumericLimits<float>::Max();
+			}
+		}
+
+		float TCurrent = T0;
+		while (TCurrent < T1)
+		{
+			const int32 NextAxis = TMax.X < TMax.Y ? (TMax.X < TMax.Z ? 0 : 2) : (TMax.Y < TMax.Z ? 1 : 2);
+			const float TNext = FMath::Min(static_cast<float>(TMax[NextAxis]), T1);
+
+			if (Visitor(Index, TCurrent, TNext))
+				return true;
+
+			TCurrent = TNext;
+			Index[NextAxis] += Step[NextAxis];
+			TMax[NextAxis] += TDelta[NextAxis];
+
+			if (Index[NextAxis] < 0 || Index[NextAxis] >= Count)
+				break;
+		}
+		return false;
+	}
+
+	void ForEachVoxelManager(UWorld* World, TFunctionRef<void(UVoxelManager&)> Function)
+	{
+		for (TObjectIterator<UVoxelManager> It; It; ++It)
+		{
+			if (It->GetWorld() == World && !It->IsTemplate())
+			{
+				Function(**It);
+			}
+		}
+	}
+
+	/* Dig Recording / Replay 콘솔 명령 */
+	FAutoConsoleCommandWithWorldAndArgs GVoxelDigRecordStartCommand(
+		TEXT("Voxel.Dig.Record.Start"),
+		TEXT("Start recording sculpts and the reference location path of every planet in the world."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			ForEachVoxelManager(World, [](UVoxelManager& Manager) { Manager.StartDigRecording(); });
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs GVoxelDigRecordStopCommand(
+		TEXT("Voxel.Dig.Record.Stop"),
+		TEXT("Stop recording and save it. Voxel.Dig.Record.Stop [Path], defaults to Saved/VoxelRecordings."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			const FString Path = Args.Num() > 0 ? Args[0] : FString();
+			ForEachVoxelManager(World, [&Path](UVoxelManager& Manager) { Manager.StopDigRecording(Path); });
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs GVoxelDigReplayCommand(
+		TEXT("Voxel.Dig.Replay"),
+		TEXT("Replay a dig recording and log frame time / per-stage stats. Voxel.Dig.Replay <Path>"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			const TSharedRef<FVoxelDigRecording> Recording = MakeShared<FVoxelDigRecording>();
+			if (Args.Num() == 0 || !Recording->LoadFromFile(Args[0]))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Voxel.Dig.Replay : failed to load '%s'"), Args.Num() > 0 ? *Args[0] : TEXT(""));
+				return;
+			}
+			ForEachVoxelManager(World, [&Recording](UVoxelManager& Manager) { Manager.StartDigReplay(Recording); });
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs GVoxelDigReplayStopCommand(
+		TEXT("Voxel.Dig.Replay.Stop"),
+		TEXT("Stop the running dig replay."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			ForEachVoxelManager(World, [](UVoxelManager& Manager) { Manager.StopDigReplay(); });
+		}));
+}
+
 // Sets default values for this component's properties
 UVoxelManager::UVoxelManager()
 {
@@ -14,7 +136,7 @@ UVoxelManager::UVoxelManager()
 	// off to improve performance if you don't need them.
 	PrimaryComponentTick.bCanEverTick = true;
 
-	// ...
+	ResultPool = MakeShared<FVoxelBuildResultPool, ESPMode::ThreadSafe>();
 }
 
 
@@ -25,30 +147,30 @@ void UVoxelManager::GenerateChunk()
 	if (ChunkNum <= 0 || CellNum <= 0 || CellSize <= 0) return;
 
 	Algo::SortBy(LODDistanceLevels, &FLODDistanceLevel::DistanceThreshold);
+	BuildStartTime = FPlatformTime::Seconds();
+
+	// Render-Free 모드는 Component를 미리 만들지 않고, Pawn 주변 Chunk만 UpdateServerChunkResidency에서 만들어서 Density를 올림
+	// 첫 갱신에서 요청한 Chunk가 시작 Build 대상
+	if (bRenderFree)
+	{
+		UpdateChunkCollisionRange();
+		TotalChunkCount = UpdateServerChunkResidency();
+		return;
+	}
 
 	TArray<FChunkGenerationRequest> GenerationRequests;
 	GenerationRequests.Reserve(ChunkNum * ChunkNum * ChunkNum);
 	
 	// Voxel은 Actor의 Location을 중점으로 생성됨
+	// Component는 아직 만들지 않고 Build Task부터 보냄, Component는 ProcessChunkCreationQueue에서 시간 예산만큼 나눠서 생성
 	for (int32 x = 0; x < ChunkNum; ++x)
 		for (int32 y = 0; y < ChunkNum; ++y)
 			for (int32 z = 0; z < ChunkNum; ++z)
 			{
-				FChunkSettingInfo ChunkInfo{ FIntVector(x,y,z), CellSize, CellNum, ChunkNum, 1};
+				FChunkSettingInfo ChunkInfo{ FIntVector(x,y,z), CellSize, CellNum, ChunkNum, 1, GetDensityApron(), DensityLayout, MesherType};
 				ChunkInfo.Calculate();
-				
-				UVoxelChunk* Chunk = NewObject<UVoxelChunk>(GetOwner());
-				Chunk->RegisterComponent();
-				Chunk->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
-				Chunk->SetRelativeLocation(ChunkInfo.ChunkPos);
-
-				Chunk->InitializeChunk((ChunkInfo));
-				Chunk->SetVoxelManager(this);
-
-				RegisterChunk(FIntVector(x,y,z), Chunk);
 
 				FChunkGenerationRequest& Request = GenerationRequests.Emplace_GetRef();
-				Request.Chunk = Chunk;
 				Request.Info = ChunkInfo;
 				const FVector ChunkWorldLocation = GetComponentTransform().TransformPosition(ChunkInfo.ChunkPos);
 				Request.DistanceSquared = FVector::DistSquared(GetReferenceLocation(), ChunkWorldLocation);
@@ -60,11 +182,80 @@ void UVoxelManager::GenerateChunk()
 	GenerationRequests.Shrink();
 	Algo::SortBy(GenerationRequests, &FChunkGenerationRequest::DistanceSquared);
 
+	// Shell Task를 Chunk Task보다 먼저, 높은 우선순위로 보냄
+	BuildStartupShell();
+
+	// 이웃 Chunk끼리 겹치는 Density를 공유하도록 하나의 Batch로 묶어서 생성
+	const TSharedPtr<FVoxelDensityBatch, ESPMode::ThreadSafe> Batch = MakeShared<FVoxelDensityBatch, ESPMode::ThreadSafe>();
+	LiveDensityBatches.Add(Batch);
+	for (const FChunkGenerationRequest& Request : GenerationRequests)
+	{
+		Batch->AddChunk(Request.Info.ChunkIndex);
+	}
+
+	PendingChunkCreations.Reset(GenerationRequests.Num());
 	for (FChunkGenerationRequest& Request : GenerationRequests)
 	{
-		EnqueueGenerateChunk(Request.Chunk, Request.Info);
+		EnqueueGenerateChunk(nullptr, Request.Info, Batch);
+		PendingChunkCreations.Add(Request.Info);
 		++TotalChunkCount;
 	}
+	NextChunkCreation = 0;
+}
+
+UVoxelChunk* UVoxelManager::CreateChunkComponent(const FChunkSettingInfo& ChunkInfo)
+{
+	UVoxelChunk* Chunk = NewObject<UVoxelChunk>(GetOwner());
+	Chunk->RegisterComponent();
+	Chunk->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
+	Chunk->SetRelativeLocation(ChunkInfo.ChunkPos);
+
+	Chunk->InitializeChunk(ChunkInfo);
+	Chunk->SetVoxelManager(this);
+	if (bRenderFree)
+	{
+		Chunk->SetRenderFree();
+	}
+
+	// 시작 Shell이 덮고 있는 영역이면 영역 교체 전까지 숨김
+	if (ActiveShellRegionSize > 0 && StartupShellRegions.Contains(ChunkInfo.ChunkIndex / ActiveShellRegionSize))
+	{
+		Chunk->SetVisibility(false);
+	}
+
+	RegisterChunk(ChunkInfo.ChunkIndex, Chunk);
+	return Chunk;
+}
+
+void UVoxelManager::ProcessChunkCreationQueue()
+{
+	if (NextChunkCreation >= PendingChunkCreations.Num())
+		return;
+
+	VOXEL_SCOPE_STAGE(CreateComponents);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double TimeBudgetSeconds = static_cast<double>(ChunkCreationTimeBudgetMs) / 1000.0;
+
+	// 거리순으로 정렬되어 있으므로 가까운 Chunk부터 생성, 매 프레임 최소 하나는 생성
+	while (NextChunkCreation < PendingChunkCreations.Num())
+	{
+		const FChunkSettingInfo& ChunkInfo = PendingChunkCreations[NextChunkCreation++];
+		if (!GetChunk(ChunkInfo.ChunkIndex))
+		{
+			CreateChunkComponent(ChunkInfo);
+		}
+
+		if (FPlatformTime::Seconds() - StartTime >= TimeBudgetSeconds)
+			break;
+	}
+
+	if (NextChunkCreation >= PendingChunkCreations.Num())
+	{
+		PendingChunkCreations.Empty();
+		NextChunkCreation = 0;
+		InitializeClusters();
+	}
 }
 
 // Called when the game starts
@@ -72,7 +263,40 @@ void UVoxelManager::BeginPlay()
 {
 	Super::BeginPlay();
 
+	{
+		FWriteScopeLock WriteLock(ChunkMapLock);
+		QueryOrigin = GetComponentLocation();
+	}
+
+	bRenderFree = bForceRenderFree || (bRenderFreeOnDedicatedServer && GetNetMode() == NM_DedicatedServer);
+	if (bRenderFree)
+	{
+		// 디스크 Cache에는 Render Mesh도 들어가므로 Server에서는 Density를 매번 생성 (Cooked Planet은 그대로 사용)
+		bUseDiskCache = false;
+		bProgressiveStartup = false;
+	}
+
+	if (!CookedPlanetPath.IsEmpty())
+	{
+		const FString Path = FPaths::IsRelative(CookedPlanetPath) ? FPaths::ProjectContentDir() / CookedPlanetPath : CookedPlanetPath;
+		CookedPlanet = FVoxelCookedPlanet::Open(Path);
+
+		const FChunkSettingInfo BaseInfo{ FIntVector::ZeroValue, CellSize, CellNum, ChunkNum, 1, GetDensityApron(), DensityLayout, MesherType };
+		if (!CookedPlanet || !CookedPlanet->IsCompatible(BaseInfo))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[VoxelManagerComponent] Cooked planet '%s' is missing or was baked with different settings, generating procedurally"), *Path);
+			CookedPlanet.Reset();
+		}
+	}
+
+	if (bUseDiskCache && GetOwner())
+	{
+		ChunkCache = MakeShared<FVoxelChunkCache, ESPMode::ThreadSafe>(FVoxelChunkCache::MakeDefaultDirectory(GetOwner()->GetName()),
+			static_cast<int64>(DiskCacheMaxMB) * 1024 * 1024);
+	}
+
 	GenerateChunk();
+	UpdateChunkCollisionRange();
 }
 
 
@@ -81,24 +305,52 @@ void UVoxelManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorCo
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	// QueryDensity는 다른 스레드에서 호출되므로 Transform 대신 복사해 둔 위치 사용
+	const FVector ComponentLocation = GetComponentLocation();
+	if (!QueryOrigin.Equals(ComponentLocation))
+	{
+		FWriteScopeLock WriteLock(ChunkMapLock);
+		QueryOrigin = ComponentLocation;
+	}
+
+	TickDigRecording(DeltaTime);
+	TickDigReplay(DeltaTime);
+	FlushNetSculptOps();
+
 	TimeSinceLastLODUpdate += DeltaTime;
 
 	const bool bShouldUpdateLOD = LODUpdateInterval <= 0.0f || TimeSinceLastLODUpdate >= LODUpdateInterval;
 	if (bShouldUpdateLOD)
 	{
 		const FVector ReferenceLocation = GetReferenceLocation();
-		UpdateChunkLODLevels(ReferenceLocation);
+		if (bRenderFree)
+		{
+			UpdateChunkCollisionRange();
+			UpdateServerChunkResidency();
+		}
+		else
+		{
+			UpdateChunkLODLevels(ReferenceLocation);
+			UpdateChunkCollisionRange();
+			UpdateClusters(ReferenceLocation);
+		}
+		EnforceMemoryBudget(ReferenceLocation);
 		if (LODUpdateInterval > 0.0f)
 		{
 			TimeSinceLastLODUpdate = 0.0f;
 		}
 	}
 	
+	ProcessChunkCreationQueue();
+	ProcessCompletedShellRegions();
 	GenerateCompletedChunk();
+	ProcessCompletedClusters();
+	ProcessCollisionCookQueue();
 }
 
 void UVoxelManager::RegisterChunk(const FIntVector& Index, UVoxelChunk* Chunk)
 {
+	FWriteScopeLock WriteLock(ChunkMapLock);
 	ChunkMap.Add(Index, Chunk);
 }
 
@@ -111,19 +363,50 @@ UVoxelChunk* UVoxelManager::GetChunk(const FIntVector& Index)
 	return nullptr;
 }
 
-void UVoxelManager::Sculpt(const FVector& ImpactPoint, float Radius)
+void UVoxelManager::Sculpt(const FVector& InImpactPoint, float InRadius)
 {
+	VOXEL_SCOPE_STAGE(Sculpt);
+
 	// Sculpt 지점과, 반지름에 영향을 받는 Chunk만 다시 Density 계산 후 mesh 재생성
 	
-	if (ChunkNum <= 0 || CellNum <= 0 || CellSize <= 0)
+	if (ChunkNum <= 0 || CellNum <= 0 || CellSize <= 0 || InRadius <= 0.0f)
 		return;
 
+	FVector ImpactPoint = InImpactPoint;
+	float Radius = InRadius;
+	if (GetNetMode() != NM_Standalone)
+	{
+		// 서버와 Client가 같은 Density를 얻도록 전송하는 양자화 값으로 적용
+		FVoxelSculptOp Op;
+		Op.LocalCenter = FVector3f(ImpactPoint - GetComponentLocation());
+		Op.Radius = Radius;
+		Op = VoxelSculptCodec::Quantize(Op, CellSize);
+		ImpactPoint = GetComponentLocation() + FVector(Op.LocalCenter);
+		Radius = Op.Radius;
+
+		if (GetNetMode() != NM_Client)
+		{
+			PendingNetSculptOps.Add(Op);
+		}
+	}
+
+	if (DigRecording)
+	{
+		FVoxelDigEvent& Event = DigRecording->Events.AddDefaulted_GetRef();
+		Event.Type = EVoxelDigEventType::Sculpt;
+		Event.Time = DigRecordingTime;
+		Event.Location = FVector3f(ImpactPoint - GetComponentLocation());
+		Event.Radius = Radius;
+	}
+
 	const int ChunkSize = CellSize * CellNum;
 	const float VoxelSize = ChunkSize * ChunkNum;
 	const FVector VoxelMinCorner = GetComponentLocation() - FVector(VoxelSize) * 0.5f;
 
-	const FVector SculptMin = ImpactPoint - FVector(Radius);
-	const FVector SculptMax = ImpactPoint + FVector(Radius);
+	// 이웃 Chunk의 Apron 꼭짓점도 갱신되도록 Apron 크기만큼 넓혀서 검사
+	const float ApronExtent = GetDensityApron() * CellSize;
+	const FVector SculptMin = ImpactPoint - FVector(Radius + ApronExtent);
+	const FVector SculptMax = ImpactPoint + FVector(Radius + ApronExtent);
 
 	auto ComputeMinIndex = [&](float Coordinate, int32 Axis) -> int32
 	{
@@ -153,26 +436,241 @@ void UVoxelManager::Sculpt(const FVector& ImpactPoint, float Radius)
 		{
 			for (int32 z = StartZ; z <= EndZ; ++z)
 			{
-				if (UVoxelChunk* Chunk = GetChunk(FIntVector(x, y, z)))
+				UVoxelChunk* Chunk = GetChunk(FIntVector(x, y, z));
+				if (Chunk && Chunk->HasDensityData())
 				{
 					Chunk->Sculpt(ImpactPoint, Radius);
+					continue;
+				}
+
+				const FIntVector ChunkIndex(x, y, z);
+				if (bRenderFree)
+				{
+					// Server는 기록을 바로 남겨야 Snapshot / Query에 반영됨, Build 중이면 도착한 Density에도 다시 적용
+					const bool bLoadPending = PendingDensityLoads.Contains(ChunkIndex);
+					RecordProceduralSculpt(ChunkIndex, ImpactPoint - GetComponentLocation(), Radius);
+					if (!Chunk || !bLoadPending)
+					{
+						// 절차적 Query에는 Sculpt 기록이 반영되지 않으므로 범위 밖이어도 Component를 만들어서 올림
+						// Sculpt된 Chunk는 Residency에서 해제되지 않으므로 한 번만 올림
+						RequestDensityReload(Chunk ? Chunk : CreateChunkComponent(MakeResidentChunkInfo(ChunkIndex)));
+						continue;
+					}
+				}
+				// 예산 때문에 Density를 버린 Chunk는 다시 Build하고 도착하면 아래 연산을 적용
+				else if (Chunk && Chunk->IsDensityReleased())
+				{
+					RequestDensityReload(Chunk);
+				}
+
+				FVoxelSculptOp& Deferred = DeferredSculptOps.FindOrAdd(ChunkIndex).AddDefaulted_GetRef();
+				Deferred.LocalCenter = FVector3f(ImpactPoint - GetComponentLocation());
+				Deferred.Radius = Radius;
+			}
+		}
+	}
+}
+
+void UVoxelManager::ReplayDeferredSculpts(UVoxelChunk* Chunk)
+{
+	TArray<FVoxelSculptOp> Ops;
+	if (!DeferredSculptOps.RemoveAndCopyValue(Chunk->GetChunkInfo().ChunkIndex, Ops))
+		return;
+
+	for (const FVoxelSculptOp& Op : Ops)
+	{
+		Chunk->Sculpt(GetComponentLocation() + FVector(Op.LocalCenter), Op.Radius);
+	}
+}
+
+void UVoxelManager::RecordProceduralSculpt(const FIntVector& ChunkIndex, const FVector& LocalCenter, float Radius)
+{
+	// 첫 Build와 같은 LOD 1 기준 꼭짓점 Index로 기록
+	FChunkSettingInfo Info{ ChunkIndex, CellSize, CellNum, ChunkNum, 1, GetDensityApron(), DensityLayout, MesherType };
+	Info.Calculate();
+
+	const FVector ChunkMin = Info.ChunkPos - FVector(Info.ChunkSize) * 0.5f;
+	auto ToRange = [&](int32 Axis, int32& OutStart, int32& OutEnd)
+	{
+		const float Center = LocalCenter[Axis] - ChunkMin[Axis];
+		OutStart = FMath::Clamp(FMath::FloorToInt((Center - Radius) / CellSize), -Info.Apron, CellNum + Info.Apron);
+		OutEnd = FMath::Clamp(FMath::CeilToInt((Center + Radius) / CellSize), -Info.Apron, CellNum + Info.Apron);
+	};
+
+	int32 StartX, EndX, StartY, EndY, StartZ, EndZ;
+	ToRange(0, StartX, EndX);
+	ToRange(1, StartY, EndY);
+	ToRange(2, StartZ, EndZ);
+
+	const float RadiusSquared = Radius * Radius;
+	FScopeLock Lock(&SculptedDensityLock);
+	FChunkSculptOverrides* ChunkOverrides = SculptedDensityMap.Find(ChunkIndex);
+	for (int32 z = StartZ; z <= EndZ; ++z)
+	{
+		for (int32 y = StartY; y <= EndY; ++y)
+		{
+			for (int32 x = StartX; x <= EndX; ++x)
+			{
+				const FVector VertexPosition = ChunkMin + FVector(x, y, z) * CellSize;
+				const float DistanceSquared = FVector::DistSquared(VertexPosition, LocalCenter);
+				if (DistanceSquared > RadiusSquared)
+					continue;
+
+				// 이전 기록이 있으면 그 값, 없으면 Build 때와 같은 절차적 Density에서 파냄
+				const int32 VertexIndex = VoxelHelper::GetIndex(x, y, z, Info);
+				const FFloat16* Existing = ChunkOverrides ? ChunkOverrides->VertexDensities.Find(VertexIndex) : nullptr;
+				const float CurrentDensity = Existing ? static_cast<float>(*Existing) : UVoxelChunk::EvaluateProceduralDensity(VertexPosition, Info.VoxelSize);
+				const float NewDensity = FMath::Min(CurrentDensity, FMath::Sqrt(DistanceSquared) - Radius);
+				if (FMath::IsNearlyEqual(CurrentDensity, NewDensity))
+					continue;
+
+				if (!ChunkOverrides)
+				{
+					ChunkOverrides = &SculptedDensityMap.Add(ChunkIndex);
 				}
+				ChunkOverrides->VertexDensities.Add(VertexIndex, FFloat16(NewDensity));
+				ChunkOverrides->SculptHash = HashCombine(ChunkOverrides->SculptHash, HashCombine(GetTypeHash(VertexIndex), GetTypeHash(NewDensity)));
+			}
+		}
+	}
+}
+
+int32 UVoxelManager::GetDensityApron() const
+{
+	// Dual Mesher는 사용하는 LOD 중 가장 큰 경계 Cell만큼 Apron이 있어야 같은 LOD 이웃과 Seam이 맞음
+	int32 Apron = FMath::Max(1, DensityApron);
+	auto Require = [&](int32 LODLevel)
+	{
+		Apron = FMath::Max(Apron, VoxelMesher::GetRequiredApron(MesherType, CellNum, LODLevel));
+	};
+
+	Require(FMath::Clamp(StartupShellLODLevel, 1, CellNum));
+	for (const FLODDistanceLevel& Level : LODDistanceLevels)
+	{
+		Require(Level.LODLevel);
+	}
+	return Apron;
+}
+
+FVector UVoxelManager::GetChunkWorldLocation(const FIntVector& ChunkIndex) const
+{
+	FChunkSettingInfo Info{ ChunkIndex, CellSize, CellNum, ChunkNum };
+	Info.Calculate();
+	return GetComponentTransform().TransformPosition(Info.ChunkPos);
+}
+
+void UVoxelManager::FlushNetSculptOps()
+{
+	if (PendingNetSculptOps.Num() == 0)
+		return;
+
+	TArray<uint8> Batch;
+	VoxelSculptCodec::EncodeOps(PendingNetSculptOps, CellSize, Batch);
+	PendingNetSculptOps.Reset();
+
+	// Listen Server의 Local Controller는 이미 적용했으므로 원격 Client에만 보냄
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* Controller = It->Get();
+		if (!Controller || Controller->IsLocalController())
+			continue;
+
+		if (UVoxelNetComponent* NetComponent = Controller->FindComponentByClass<UVoxelNetComponent>())
+		{
+			NetComponent->SendSculptBatch(this, Batch);
+		}
+	}
+}
+
+void UVoxelManager::ApplyNetSculptBatch(const TArray<uint8>& Batch)
+{
+	TArray<FVoxelSculptOp> Ops;
+	if (!VoxelSculptCodec::DecodeOps(Batch, CellSize, Ops))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[VoxelManagerComponent] Dropped malformed sculpt batch (%d bytes)"), Batch.Num());
+		return;
+	}
+
+	for (const FVoxelSculptOp& Op : Ops)
+	{
+		Sculpt(GetComponentLocation() + FVector(Op.LocalCenter), Op.Radius);
+	}
+}
+
+void UVoxelManager::ApplyNetSculptSnapshot(const FIntVector& ChunkIndex, TConstArrayView<TPair<int32, FFloat16>> Overrides)
+{
+	{
+		FScopeLock Lock(&SculptedDensityLock);
+		FChunkSculptOverrides& ChunkOverrides = SculptedDensityMap.FindOrAdd(ChunkIndex);
+		for (const TPair<int32, FFloat16>& Override : Overrides)
+		{
+			// Dig는 최소값만 남기므로 이미 받은 Batch와 순서가 바뀌어도 결과가 같음
+			FFloat16* Existing = ChunkOverrides.VertexDensities.Find(Override.Key);
+			if (Existing && static_cast<float>(*Existing) <= static_cast<float>(Override.Value))
+				continue;
+
+			ChunkOverrides.VertexDensities.Add(Override.Key, Override.Value);
+			ChunkOverrides.SculptHash = HashCombine(ChunkOverrides.SculptHash, HashCombine(GetTypeHash(Override.Key), GetTypeHash(Override.Value.Encoded)));
+		}
+	}
+
+	// 아직 Build되지 않은 Chunk는 첫 Build에서 기록이 반영됨
+	UVoxelChunk* Chunk = GetChunk(ChunkIndex);
+	if (Chunk && Chunk->HasDensityData())
+	{
+		Chunk->ApplyDensityOverrides(Overrides);
+	}
+	else if (Chunk && Chunk->IsDensityReleased() && !bRenderFree)
+	{
+		// Density를 버린 Chunk는 절차적 Density로 Query되므로 Sculpt 기록이 생기면 다시 올림
+		RequestDensityReload(Chunk);
+	}
+}
+
+void UVoxelManager::GetSculptedChunkIndices(TArray<FIntVector>& OutChunkIndices) const
+{
+	FScopeLock Lock(&SculptedDensityLock);
+	SculptedDensityMap.GetKeys(OutChunkIndices);
+}
+
+void UVoxelManager::GetSortedSculptOverrides(const FIntVector& ChunkIndex, TArray<TPair<int32, FFloat16>>& OutOverrides) const
+{
+	OutOverrides.Reset();
+	{
+		FScopeLock Lock(&SculptedDensityLock);
+		if (const FChunkSculptOverrides* ChunkOverrides = SculptedDensityMap.Find(ChunkIndex))
+		{
+			OutOverrides.Reserve(ChunkOverrides->VertexDensities.Num());
+			for (const TPair<int32, FFloat16>& Override : ChunkOverrides->VertexDensities)
+			{
+				OutOverrides.Emplace(Override.Key, Override.Value);
 			}
 		}
 	}
+	Algo::SortBy(OutOverrides, &TPair<int32, FFloat16>::Key);
 }
 
 void UVoxelManager::RecordSculptedDensity(const FChunkSettingInfo& Info, int32 LocalX, int32 LocalY, int32 LocalZ, float Density)
 {
 	FScopeLock Lock(&SculptedDensityLock);
 	UVoxelManager::FChunkSculptOverrides& ChunkOverrides = SculptedDensityMap.FindOrAdd(Info.ChunkIndex);
-	const int32 VertexIndex = VoxelHelper::GetIndex(LocalX, LocalY, LocalZ, Info.CellNum);
+	const int32 VertexIndex = VoxelHelper::GetIndex(LocalX, LocalY, LocalZ, Info);
 
 	ChunkOverrides.VertexDensities.Add(VertexIndex, FFloat16(Density));
+	ChunkOverrides.SculptHash = HashCombine(ChunkOverrides.SculptHash, HashCombine(GetTypeHash(VertexIndex), GetTypeHash(Density)));
+}
+
+uint32 UVoxelManager::GetSculptHash(const FIntVector& ChunkIndex) const
+{
+	FScopeLock Lock(&SculptedDensityLock);
+	const FChunkSculptOverrides* ChunkOverrides = SculptedDensityMap.Find(ChunkIndex);
+	return ChunkOverrides ? ChunkOverrides->SculptHash : 0;
 }
 
 void UVoxelManager::ApplySculptedDensityOverrides(const FChunkSettingInfo& Info, TArray<FVertexDensity>& DensityData)
 {
+	VOXEL_SCOPE_STAGE(ApplyOverrides);
+
 	if (DensityData.Num() == 0)
 	{
 		return;
@@ -226,24 +724,87 @@ void UVoxelManager::ApplySculptedDensityOverrides(const FChunkSettingInfo& Info,
 }
 
 
-void UVoxelManager::EnqueueGenerateChunk(UVoxelChunk* Chunk, const FChunkSettingInfo& ChunkInfo)
+void UVoxelManager::EnqueueGenerateChunk(UVoxelChunk* Chunk, const FChunkSettingInfo& ChunkInfo,
+	const TSharedPtr<FVoxelDensityBatch, ESPMode::ThreadSafe>& Batch)
 {
-	if (!IsValid(Chunk)) return;
+	// Chunk가 nullptr이면 Component 생성 전에 보낸 첫 Build, 결과가 도착하면 ChunkIndex로 찾거나 그때 생성
+	if (Chunk)
+	{
+		if (!IsValid(Chunk)) return;
+		Chunk->SetRequestedLODLevel(ChunkInfo.LODLevel);
+	}
+	INC_DWORD_STAT(STAT_VoxelBuildsInFlight);
 
-	Chunk->SetRequestedLODLevel(ChunkInfo.LODLevel);
+	FChunkSettingInfo BuildInfo = ChunkInfo;
+	BuildInfo.TriangleBudget = ComputeTriangleBudget(ChunkInfo.LODLevel);
+	BuildsInFlight.fetch_add(1, std::memory_order_relaxed);
 	
 	TWeakObjectPtr<UVoxelManager> ManagerPtr(this);
 	TWeakObjectPtr<UVoxelChunk> ChunkPtr(Chunk);
+	TSharedPtr<FVoxelBuildResultPool, ESPMode::ThreadSafe> Pool = ResultPool;
+	TSharedPtr<FVoxelChunkCache, ESPMode::ThreadSafe> Cache = ChunkCache;
+	const uint32 SculptHash = Cache ? GetSculptHash(ChunkInfo.ChunkIndex) : 0;
 
 	UE::Tasks::Launch(
-		UE_SOURCE_LOCATION, [ManagerPtr, ChunkPtr, ChunkInfo]()
+		UE_SOURCE_LOCATION, [ManagerPtr, ChunkPtr, ChunkInfo = BuildInfo, Batch, Pool, Cache, SculptHash]()
 		{
 			UVoxelManager* Manager = ManagerPtr.Get();
-			FChunkBuildResult Result = UVoxelChunk::GenerateChunkData(ChunkInfo, Manager);
+
+			// 이전에 소비된 결과 버퍼를 재사용해서 할당 없이 채움
+			TUniquePtr<FPendingChunkResult> Pending = Pool->Acquire();
+			Pending->Chunk = ChunkPtr;
+			Pending->Info = ChunkInfo;
+
+			// Density는 LOD와 무관하게 Chunk당 하나, Mesh만 LOD별로 저장되어 있음
+			TArray<uint8> DensityEntry;
+			TArray<uint8> MeshEntry;
+			const bool bDensityCached = Cache && Cache->LoadDensity(ChunkInfo, SculptHash, Pending->Result);
+			if (bDensityCached && Batch)
+			{
+				Batch->SkipChunk(ChunkInfo.ChunkIndex);
+			}
+
+			if (!bDensityCached || !Cache->LoadMesh(ChunkInfo, SculptHash, Pending->Result.MeshData))
+			{
+				if (bDensityCached)
+				{
+					UVoxelChunk::GenerateChunkMeshData(ChunkInfo, Manager, Pending->Result);
+				}
+				else
+				{
+					UVoxelChunk::GenerateChunkData(ChunkInfo, Manager, Batch.Get(), Pending->Result);
+				}
+
+				// 생성 중에 Sculpt가 더 기록됐으면 Key와 내용이 다르므로 저장하지 않음
+				if (Cache && Manager && Manager->GetSculptHash(ChunkInfo.ChunkIndex) == SculptHash)
+				{
+					if (!bDensityCached)
+					{
+						DensityEntry = FVoxelChunkCache::SerializeDensity(ChunkInfo, SculptHash, Pending->Result.DensityData);
+					}
+					MeshEntry = FVoxelChunkCache::SerializeMesh(ChunkInfo, SculptHash, Pending->Result.MeshData);
+				}
+			}
+			DEC_DWORD_STAT(STAT_VoxelBuildsInFlight);
 
 			if (Manager)
 			{
-				   Manager->PushCompletedResult(MoveTemp(Result), ChunkPtr, ChunkInfo);
+				Manager->PushCompletedResult(MoveTemp(Pending));
+				Manager->BuildsInFlight.fetch_sub(1, std::memory_order_relaxed);
+			}
+			else
+			{
+				Pool->Release(MoveTemp(Pending));
+			}
+
+			// 결과를 먼저 넘기고 압축 / 파일 쓰기
+			if (DensityEntry.Num() > 0)
+			{
+				Cache->WriteDensity(ChunkInfo, DensityEntry);
+			}
+			if (MeshEntry.Num() > 0)
+			{
+				Cache->WriteMesh(ChunkInfo, MeshEntry);
 			}
 		},
 	UE::Tasks::ETaskPriority::BackgroundHigh
@@ -252,7 +813,9 @@ void UVoxelManager::EnqueueGenerateChunk(UVoxelChunk* Chunk, const FChunkSetting
 
 void UVoxelManager::GenerateCompletedChunk()
 {
-	FPendingChunkResult PendingResult;
+	VOXEL_SCOPE_STAGE(ProcessCompleted);
+
+	TUniquePtr<FPendingChunkResult> PendingResult;
 	const double StartTime = FPlatformTime::Seconds();
 	int32 ProcessedCount = 0;
 	const double TimeBudgetSeconds = ChunkProcessingTimeBudgetMs > 0.0f
@@ -261,22 +824,45 @@ void UVoxelManager::GenerateCompletedChunk()
 	
 	while (CompletedChunkDataQueue.Dequeue(PendingResult))
 	{
-		if (PendingResult.Chunk.IsValid())
+		CompletedQueueDepth.fetch_sub(1, std::memory_order_relaxed);
+		DEC_DWORD_STAT(STAT_VoxelCompletedQueueDepth);
+		PendingDensityLoads.Remove(PendingResult->Info.ChunkIndex);
+
+		// Component보다 먼저 보낸 Build면 생성 Queue 순서를 기다리지 않고 바로 생성
+		if (PendingResult->Chunk.IsExplicitlyNull())
+		{
+			UVoxelChunk* Chunk = GetChunk(PendingResult->Info.ChunkIndex);
+			PendingResult->Chunk = Chunk ? Chunk : CreateChunkComponent(PendingResult->Info);
+		}
+
+		if (PendingResult->Chunk.IsValid())
 		{
-			if (UVoxelChunk* Chunk = PendingResult.Chunk.Get())
+			if (UVoxelChunk* Chunk = PendingResult->Chunk.Get())
 			{
 				// 플레이어 이동에 따라 LOD가 변경되었으면 Mesh를 재생성하지 않고 넘어감, 다른 queue에 있는 변경된 LOD로 mesh 생성 
-				if (PendingResult.Info.LODLevel != Chunk->GetRequestedLODLevel())
+				if (PendingResult->Info.LODLevel != Chunk->GetRequestedLODLevel())
 				{
+					ResultPool->Release(MoveTemp(PendingResult));
+					INC_DWORD_STAT(STAT_VoxelDiscardedBuilds);
+					++DiscardedBuildCount;
 					++ProcessedCount;
 					++CompletedChunkCount;
 					continue;
 				}
 				
-				Chunk->GenerateChunkMesh(PendingResult.Info, MoveTemp(PendingResult.Result));
+				const bool bFirstBuild = !Chunk->HasDensityData();
+				Chunk->GenerateChunkMesh(PendingResult->Info, PendingResult->Result);
+				if (bFirstBuild)
+				{
+					OnChunkFirstBuilt(Chunk);
+					ReplayDeferredSculpts(Chunk);
+				}
 			}
 		}
 
+		// Chunk와 Swap된 이전 데이터 버퍼를 Pool에 반환
+		ResultPool->Release(MoveTemp(PendingResult));
+
 		++CompletedChunkCount;
 		++ProcessedCount;
 
@@ -289,42 +875,216 @@ void UVoxelManager::GenerateCompletedChunk()
 			break;
 	}
 
-	if (!bLoggedBuildTime && TotalChunkCount > 0 && CompletedChunkCount >= TotalChunkCount)
+	INC_DWORD_STAT_BY(STAT_VoxelChunksPerFrame, ProcessedCount);
+	TRACE_COUNTER_SET(VoxelChunksPerFrame, ProcessedCount);
+	TRACE_COUNTER_SET(VoxelCompletedQueueDepth, CompletedQueueDepth.load(std::memory_order_relaxed));
+	TRACE_COUNTER_SET(VoxelDiscardedBuilds, DiscardedBuildCount);
+
+	if (!bLoggedBuildTime && IsInitialBuildComplete())
 	{
 		const double ElapsedMs = (FPlatformTime::Seconds() - BuildStartTime) * 1000.0;
+		InitialBuildTimeMs = ElapsedMs;
 		UE_LOG(LogTemp, Warning, TEXT("[VoxelManagerComponent] Build Time : %.2f ms"), ElapsedMs);
 		bLoggedBuildTime = true;
 	}
 }
 
-void UVoxelManager::PushCompletedResult(FChunkBuildResult&& Result, const TWeakObjectPtr<UVoxelChunk>& Chunk,
-                                        const FChunkSettingInfo& ChunkInfo)
+void UVoxelManager::PushCompletedResult(TUniquePtr<FPendingChunkResult>&& Pending)
 {
-	FPendingChunkResult Pending;
-	Pending.Chunk = Chunk;
-	Pending.Info = ChunkInfo;
-	Pending.Result = MoveTemp(Result);
+	// 소유권만 이동, 배열 데이터는 복사되지 않음
+	CompletedChunkDataQueue.Enqueue(MoveTemp(Pending));
+	CompletedQueueDepth.fetch_add(1, std::memory_order_relaxed);
+	INC_DWORD_STAT(STAT_VoxelCompletedQueueDepth);
+}
 
-	CompletedChunkDataQueue.Enqueue(Pending);
+void UVoxelManager::SetChunkProcessingBudget(int32 InMaxChunksPerFrame, float InTimeBudgetMs)
+{
+	MaxChunksPerFrame = FMath::Max(0, InMaxChunksPerFrame);
+	ChunkProcessingTimeBudgetMs = FMath::Max(0.0f, InTimeBudgetMs);
 }
 
-FVector UVoxelManager::GetReferenceLocation() const
+void UVoxelManager::StartDigRecording()
 {
-	if (UWorld* World = GetWorld())
-	{
-		if (APawn* Pawn = UGameplayStatics::GetPlayerPawn(World, 0))
-		{
-			return Pawn->GetActorLocation();
-		}
-	}
-	return GetComponentLocation();
+	DigRecording = MakeUnique<FVoxelDigRecording>();
+	DigRecording->CellSize = CellSize;
+	DigRecording->CellNum = CellNum;
+	DigRecording->ChunkNum = ChunkNum;
+	DigRecordingTime = 0.0f;
+	// 첫 Tick에서 시작 위치를 바로 기록
+	TimeSinceLastPathSample = DigPathSampleInterval;
 }
 
-int32 UVoxelManager::ComputeLODLevel(float Distance) const
+FString UVoxelManager::StopDigRecording(const FString& Path)
 {
-	int32 LODLevel = 1;
+	if (!DigRecording)
+		return FString();
 
-	for (const FLODDistanceLevel& Entry : LODDistanceLevels)
+	const FString SavePath = Path.IsEmpty() ? FVoxelDigRecording::MakeDefaultPath(GetOwner() ? GetOwner()->GetName() : GetName()) : Path;
+	const bool bSaved = DigRecording->SaveToFile(SavePath);
+	UE_LOG(LogTemp, Display, TEXT("Dig recording %s : %d events, %.1f s -> %s"), bSaved ? TEXT("saved") : TEXT("failed"),
+		DigRecording->Events.Num(), DigRecording->GetDuration(), *SavePath);
+
+	DigRecording.Reset();
+	return bSaved ? SavePath : FString();
+}
+
+void UVoxelManager::StartDigReplay(const TSharedRef<const FVoxelDigRecording>& Recording)
+{
+	if (Recording->CellSize != CellSize || Recording->CellNum != CellNum || Recording->ChunkNum != ChunkNum)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Dig recording was made with CellSize=%d CellNum=%d ChunkNum=%d, replaying on CellSize=%d CellNum=%d ChunkNum=%d"),
+			Recording->CellSize, Recording->CellNum, Recording->ChunkNum, CellSize, CellNum, ChunkNum);
+	}
+
+	const TOptional<FVector> PreviousOverride = DigReplay ? DigReplay->PreviousReferenceOverride : ReferenceLocationOverride;
+	DigReplay = MakeUnique<FDigReplayState>();
+	DigReplay->Recording = Recording;
+	DigReplay->PreviousReferenceOverride = PreviousOverride;
+	DigReplay->LastFrameTime = FPlatformTime::Seconds();
+	DigReplay->FrameMs.Reserve(FMath::CeilToInt(Recording->GetDuration() * 60.0f) + 1);
+
+	FVoxelPipelineCounters::Get().Reset();
+}
+
+void UVoxelManager::StopDigReplay()
+{
+	if (DigReplay)
+	{
+		FinishDigReplay();
+	}
+}
+
+void UVoxelManager::TickDigRecording(float DeltaTime)
+{
+	if (!DigRecording)
+		return;
+
+	DigRecordingTime += DeltaTime;
+	TimeSinceLastPathSample += DeltaTime;
+	if (TimeSinceLastPathSample < DigPathSampleInterval)
+		return;
+
+	TimeSinceLastPathSample = 0.0f;
+
+	// 움직이지 않았으면 기록하지 않음
+	const FVector3f Location(GetReferenceLocation() - GetComponentLocation());
+	for (int32 i = DigRecording->Events.Num() - 1; i >= 0; --i)
+	{
+		const FVoxelDigEvent& Previous = DigRecording->Events[i];
+		if (Previous.Type != EVoxelDigEventType::Reference)
+			continue;
+
+		if (Previous.Location.Equals(Location, 1.0f))
+			return;
+		break;
+	}
+
+	FVoxelDigEvent& Event = DigRecording->Events.AddDefaulted_GetRef();
+	Event.Type = EVoxelDigEventType::Reference;
+	Event.Time = DigRecordingTime;
+	Event.Location = Location;
+}
+
+void UVoxelManager::TickDigReplay(float DeltaTime)
+{
+	if (!DigReplay)
+		return;
+
+	// 이전 Manager Tick부터의 실제 시간 = 이전 Frame 전체 시간
+	const double Now = FPlatformTime::Seconds();
+	if (DigReplay->Time > 0.0f)
+	{
+		DigReplay->FrameMs.Add((Now - DigReplay->LastFrameTime) * 1000.0);
+	}
+	DigReplay->LastFrameTime = Now;
+	DigReplay->Time += DeltaTime;
+
+	const FVector Origin = GetComponentLocation();
+	const TArray<FVoxelDigEvent>& Events = DigReplay->Recording->Events;
+	while (DigReplay->NextEvent < Events.Num() && Events[DigReplay->NextEvent].Time <= DigReplay->Time)
+	{
+		const FVoxelDigEvent& Event = Events[DigReplay->NextEvent++];
+		const FVector Location = Origin + FVector(Event.Location);
+
+		if (Event.Type == EVoxelDigEventType::Sculpt)
+		{
+			Sculpt(Location, Event.Radius);
+			++DigReplay->SculptCount;
+		}
+		else
+		{
+			ReferenceLocationOverride = Location;
+		}
+	}
+
+	if (DigReplay->NextEvent >= Events.Num())
+	{
+		FinishDigReplay();
+	}
+}
+
+void UVoxelManager::FinishDigReplay()
+{
+	FVoxelDigReplayStats Stats;
+	Stats.Frames = DigReplay->FrameMs.Num();
+	Stats.SculptCount = DigReplay->SculptCount;
+
+	if (Stats.Frames > 0)
+	{
+		TArray<float>& FrameMs = DigReplay->FrameMs;
+		FrameMs.Sort();
+
+		double TotalMs = 0.0;
+		for (const float Ms : FrameMs)
+		{
+			TotalMs += Ms;
+		}
+		Stats.AvgFrameMs = TotalMs / Stats.Frames;
+		Stats.P95FrameMs = FrameMs[FMath::Min(FMath::FloorToInt(Stats.Frames * 0.95f), Stats.Frames - 1)];
+		Stats.MaxFrameMs = FrameMs.Last();
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Dig replay finished : %d sculpts, %d frames, avg %.2f ms, p95 %.2f ms, max %.2f ms"),
+		Stats.SculptCount, Stats.Frames, Stats.AvgFrameMs, Stats.P95FrameMs, Stats.MaxFrameMs);
+
+	const FVoxelPipelineCounters& Counters = FVoxelPipelineCounters::Get();
+	for (int32 i = 0; i < static_cast<int32>(EVoxelPipelineStage::Num); ++i)
+	{
+		const EVoxelPipelineStage Stage = static_cast<EVoxelPipelineStage>(i);
+		if (Counters.GetStageCalls(Stage) > 0)
+		{
+			UE_LOG(LogTemp, Display, TEXT("  %-16s %10.2f ms %8llu calls"), FVoxelPipelineCounters::GetStageName(Stage),
+				Counters.GetStageMs(Stage), Counters.GetStageCalls(Stage));
+		}
+	}
+
+	ReferenceLocationOverride = DigReplay->PreviousReferenceOverride;
+	LastDigReplayStats = Stats;
+	DigReplay.Reset();
+}
+
+FVector UVoxelManager::GetReferenceLocation() const
+{
+	if (ReferenceLocationOverride.IsSet())
+	{
+		return ReferenceLocationOverride.GetValue();
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		if (APawn* Pawn = UGameplayStatics::GetPlayerPawn(World, 0))
+		{
+			return Pawn->GetActorLocation();
+		}
+	}
+	return GetComponentLocation();
+}
+
+int32 UVoxelManager::ComputeLODLevel(float Distance) const
+{
+	int32 LODLevel = 1;
+
+	for (const FLODDistanceLevel& Entry : LODDistanceLevels)
 	{
 		if (Distance > Entry.DistanceThreshold)
 		{
@@ -339,8 +1099,27 @@ int32 UVoxelManager::ComputeLODLevel(float Distance) const
 	return FMath::Clamp(LODLevel, 1, CellNum);
 }
 
+int32 UVoxelManager::ComputeTriangleBudget(int32 LODLevel) const
+{
+	if (LODLevel < SimplifyMinLODLevel)
+		return 0;
+
+	for (const FLODDistanceLevel& Entry : LODDistanceLevels)
+	{
+		if (Entry.LODLevel == LODLevel)
+		{
+			return Entry.TriangleBudget;
+		}
+	}
+	return 0;
+}
+
 void UVoxelManager::UpdateChunkLODLevels(const FVector& ReferenceLocation)
 {
+	VOXEL_SCOPE_STAGE(UpdateLOD);
+
+	TArray<TPair<UVoxelChunk*, FChunkSettingInfo>> LODRequests;
+	
 	for (auto& Pair : ChunkMap)
 	{
 		UVoxelChunk* Chunk = Pair.Value;
@@ -357,8 +1136,929 @@ void UVoxelManager::UpdateChunkLODLevels(const FVector& ReferenceLocation)
 			continue;
 		}
 
-		FChunkSettingInfo RequestedInfo = Chunk->MakeChunkSettingInfoForLOD(DesiredLOD);
-		EnqueueGenerateChunk(Chunk, RequestedInfo);
+		LODRequests.Emplace(Chunk, Chunk->MakeChunkSettingInfoForLOD(DesiredLOD));
+	}
+
+	if (LODRequests.Num() == 0)
+		return;
+
+	// 같은 Tick에 LOD가 바뀐 이웃 Chunk끼리 Density 공유
+	const TSharedPtr<FVoxelDensityBatch, ESPMode::ThreadSafe> Batch = MakeShared<FVoxelDensityBatch, ESPMode::ThreadSafe>();
+	LiveDensityBatches.Add(Batch);
+	for (const TPair<UVoxelChunk*, FChunkSettingInfo>& Request : LODRequests)
+	{
+		Batch->AddChunk(Request.Value.ChunkIndex);
+	}
+
+	for (const TPair<UVoxelChunk*, FChunkSettingInfo>& Request : LODRequests)
+	{
+		EnqueueGenerateChunk(Request.Key, Request.Value, Batch);
+	}
+}
+
+
+void UVoxelManager::BuildStartupShell()
+{
+	if (!bProgressiveStartup)
+		return;
+
+	int32 RegionSize = FMath::Clamp(StartupShellRegionSize, 1, ChunkNum);
+	while (ChunkNum % RegionSize != 0)
+	{
+		--RegionSize;
+	}
+
+	// 영역이 Chunk 하나면 Shell을 만드는 비용이 Chunk와 같으므로 사용 안 함
+	if (RegionSize <= 1)
+		return;
+
+	ActiveShellRegionSize = RegionSize;
+
+	// Chunk는 영역의 Chunk가 모두 완성될 때까지 숨기고 Shell을 보여줌 (CreateChunkComponent에서 숨김)
+	for (int32 x = 0; x < ChunkNum; ++x)
+		for (int32 y = 0; y < ChunkNum; ++y)
+			for (int32 z = 0; z < ChunkNum; ++z)
+			{
+				++StartupShellRegions.FindOrAdd(FIntVector(x, y, z) / RegionSize).PendingChunks;
+			}
+
+	TArray<TPair<float, FChunkSettingInfo>> ShellRequests;
+	const FVector ReferenceLocation = GetReferenceLocation();
+	for (TPair<FIntVector, FStartupShellRegion>& Pair : StartupShellRegions)
+	{
+		FChunkSettingInfo ShellInfo{ Pair.Key, CellSize * RegionSize, CellNum, ChunkNum / RegionSize,
+			FMath::Clamp(StartupShellLODLevel, 1, CellNum), GetDensityApron(), DensityLayout, MesherType };
+		ShellInfo.Calculate();
+		Pair.Value.Center = ShellInfo.ChunkPos;
+
+		const float DistanceSquared = FVector::DistSquared(ReferenceLocation, GetComponentTransform().TransformPosition(ShellInfo.ChunkPos));
+		ShellRequests.Emplace(DistanceSquared, ShellInfo);
+	}
+	Algo::SortBy(ShellRequests, &TPair<float, FChunkSettingInfo>::Key);
+
+	TWeakObjectPtr<UVoxelManager> ManagerPtr(this);
+	for (const TPair<float, FChunkSettingInfo>& Request : ShellRequests)
+	{
+		UE::Tasks::Launch(
+			UE_SOURCE_LOCATION, [ManagerPtr, ShellInfo = Request.Value]()
+			{
+				TUniquePtr<FVoxelClusterBuildResult> Result = MakeUnique<FVoxelClusterBuildResult>();
+				Result->ClusterIndex = ShellInfo.ChunkIndex;
+				UVoxelCluster::BuildShellMesh(ShellInfo, Result->Mesh);
+
+				if (UVoxelManager* Manager = ManagerPtr.Get())
+				{
+					Manager->CompletedShellQueue.Enqueue(MoveTemp(Result));
+				}
+			},
+		UE::Tasks::ETaskPriority::High
+		);
+	}
+}
+
+void UVoxelManager::ProcessCompletedShellRegions()
+{
+	TUniquePtr<FVoxelClusterBuildResult> Result;
+	while (CompletedShellQueue.Dequeue(Result))
+	{
+		// Chunk가 먼저 완성된 영역은 Shell이 필요 없음
+		FStartupShellRegion* Region = StartupShellRegions.Find(Result->ClusterIndex);
+		if (!Region)
+			continue;
+
+		UVoxelCluster* Component = NewObject<UVoxelCluster>(GetOwner());
+		Component->RegisterComponent();
+		Component->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
+		Component->SetRelativeLocation(Region->Center);
+		if (const UVoxelChunk* Chunk = GetChunk(Result->ClusterIndex * ActiveShellRegionSize))
+		{
+			Component->SetMaterial(0, Chunk->GetMaterial(0));
+		}
+		Component->ApplyMesh(MoveTemp(Result->Mesh));
+		Component->SetVisibility(true);
+		Region->Component = Component;
+
+		MarkFirstVisible();
+	}
+}
+
+void UVoxelManager::OnChunkFirstBuilt(const UVoxelChunk* Chunk)
+{
+	if (StartupShellRegions.Num() == 0)
+	{
+		MarkFirstVisible();
+		return;
+	}
+
+	const FIntVector RegionIndex = Chunk->GetChunkInfo().ChunkIndex / ActiveShellRegionSize;
+	FStartupShellRegion* Region = StartupShellRegions.Find(RegionIndex);
+	if (!Region || --Region->PendingChunks > 0)
+		return;
+
+	// 영역의 Chunk가 모두 완성되면 한 번에 교체해서 Shell과 Chunk가 겹쳐 보이지 않도록 함
+	const FIntVector RegionMin = RegionIndex * ActiveShellRegionSize;
+	for (int32 x = 0; x < ActiveShellRegionSize; ++x)
+		for (int32 y = 0; y < ActiveShellRegionSize; ++y)
+			for (int32 z = 0; z < ActiveShellRegionSize; ++z)
+			{
+				if (UVoxelChunk* RegionChunk = GetChunk(RegionMin + FIntVector(x, y, z)))
+				{
+					RegionChunk->SetVisibility(true);
+				}
+			}
+
+	if (UVoxelCluster* Component = Region->Component.Get())
+	{
+		Component->DestroyComponent();
+	}
+	StartupShellRegions.Remove(RegionIndex);
+	MarkFirstVisible();
+
+	if (StartupShellRegions.Num() == 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("[VoxelManagerComponent] Startup shell fully refined : %.2f ms"),
+			(FPlatformTime::Seconds() - BuildStartTime) * 1000.0);
+	}
+}
+
+void UVoxelManager::MarkFirstVisible()
+{
+	if (FirstVisibleTimeMs > 0.0)
+		return;
+
+	FirstVisibleTimeMs = (FPlatformTime::Seconds() - BuildStartTime) * 1000.0;
+	UE_LOG(LogTemp, Display, TEXT("[VoxelManagerComponent] First visible : %.2f ms"), FirstVisibleTimeMs);
+}
+
+void UVoxelManager::InitializeClusters()
+{
+	if (ClusterSize <= 1)
+		return;
+
+	const FVector HalfChunkExtent(CellSize * CellNum * 0.5f);
+	for (const TPair<FIntVector, UVoxelChunk*>& Pair : ChunkMap)
+	{
+		FChunkCluster& Cluster = Clusters.FindOrAdd(Pair.Key / ClusterSize);
+		Cluster.Members.Add(Pair.Value);
+		Cluster.LocalBounds += FBox::BuildAABB(Pair.Value->GetChunkInfo().ChunkPos, HalfChunkExtent);
+	}
+}
+
+void UVoxelManager::NotifyChunkMeshChanged(UVoxelChunk* Chunk)
+{
+	if (ClusterSize <= 1 || !IsValid(Chunk))
+		return;
+
+	FChunkCluster* Cluster = Clusters.Find(Chunk->GetChunkInfo().ChunkIndex / ClusterSize);
+	if (!Cluster)
+		return;
+
+	// 합쳐진 Mesh는 이전 모양이므로 바로 개별 Chunk로 되돌림
+	Cluster->LastChangeTime = FPlatformTime::Seconds();
+	SplitCluster(*Cluster);
+}
+
+void UVoxelManager::UpdateClusters(const FVector& ReferenceLocation)
+{
+	// 시작 Shell 교체가 끝날 때까지는 Chunk 표시를 Shell 쪽에서 관리
+	if (ClusterSize <= 1 || StartupShellRegions.Num() > 0)
+		return;
+
+	const double Now = FPlatformTime::Seconds();
+	const FTransform& ManagerTransform = GetComponentTransform();
+	const float MergeDistanceSquared = FMath::Square(ClusterMergeDistance);
+
+	for (TPair<FIntVector, FChunkCluster>& Pair : Clusters)
+	{
+		FChunkCluster& Cluster = Pair.Value;
+
+		const FBox WorldBounds = Cluster.LocalBounds.TransformBy(ManagerTransform);
+		if (WorldBounds.ComputeSquaredDistanceToPoint(ReferenceLocation) < MergeDistanceSquared)
+		{
+			// 가까워지면 개별 Chunk로 나눠서 LOD / Sculpt 변화를 바로 보여줌
+			SplitCluster(Cluster);
+			continue;
+		}
+
+		if (Cluster.bMerged || Cluster.bBuildInFlight || Now - Cluster.LastChangeTime < ClusterStableTime)
+			continue;
+
+		// 아직 만들어지지 않았거나 LOD Build가 진행 중인 멤버가 있으면 안정되지 않은 것으로 봄
+		const bool bStable = Cluster.Members.Num() > 1 && Algo::AllOf(Cluster.Members, [](const TWeakObjectPtr<UVoxelChunk>& Member)
+		{
+			const UVoxelChunk* Chunk = Member.Get();
+			return Chunk && Chunk->HasDensityData() && Chunk->GetCurrentLODLevel() == Chunk->GetRequestedLODLevel();
+		});
+
+		if (bStable)
+		{
+			LaunchClusterBuild(Pair.Key, Cluster);
+		}
+	}
+}
+
+void UVoxelManager::LaunchClusterBuild(const FIntVector& ClusterIndex, FChunkCluster& Cluster)
+{
+	// 멤버 Mesh는 Game Thread에서만 바뀌므로 여기서 복사해서 넘김
+	TArray<FVoxelClusterMemberMesh> MemberMeshes;
+	MemberMeshes.Reserve(Cluster.Members.Num());
+	const FVector ClusterCenter = Cluster.LocalBounds.GetCenter();
+	for (const TWeakObjectPtr<UVoxelChunk>& Member : Cluster.Members)
+	{
+		const UVoxelChunk* Chunk = Member.Get();
+		FVoxelClusterMemberMesh& MemberMesh = MemberMeshes.AddDefaulted_GetRef();
+		MemberMesh.Offset = Chunk->GetChunkInfo().ChunkPos - ClusterCenter;
+		Chunk->CopyMeshData(MemberMesh.MeshData);
+	}
+
+	Cluster.bBuildInFlight = true;
+
+	TWeakObjectPtr<UVoxelManager> ManagerPtr(this);
+	const uint32 Revision = Cluster.Revision;
+
+	UE::Tasks::Launch(
+		UE_SOURCE_LOCATION, [ManagerPtr, ClusterIndex, Revision, MemberMeshes = MoveTemp(MemberMeshes)]()
+		{
+			TUniquePtr<FVoxelClusterBuildResult> Result = MakeUnique<FVoxelClusterBuildResult>();
+			Result->ClusterIndex = ClusterIndex;
+			Result->Revision = Revision;
+			UVoxelCluster::BuildClusterMesh(MemberMeshes, Result->Mesh);
+
+			if (UVoxelManager* Manager = ManagerPtr.Get())
+			{
+				Manager->CompletedClusterQueue.Enqueue(MoveTemp(Result));
+			}
+		},
+	UE::Tasks::ETaskPriority::BackgroundNormal
+	);
+}
+
+void UVoxelManager::ProcessCompletedClusters()
+{
+	TUniquePtr<FVoxelClusterBuildResult> Result;
+	while (CompletedClusterQueue.Dequeue(Result))
+	{
+		FChunkCluster* Cluster = Clusters.Find(Result->ClusterIndex);
+		if (!Cluster)
+			continue;
+
+		Cluster->bBuildInFlight = false;
+
+		// Build 도중 멤버가 바뀌었거나 가까워져서 나뉜 경우 버리고 다음 UpdateClusters에서 다시 만듦
+		if (Result->Revision != Cluster->Revision)
+		{
+			INC_DWORD_STAT(STAT_VoxelDiscardedBuilds);
+			continue;
+		}
+
+		ApplyClusterMesh(*Cluster, *Result);
+	}
+}
+
+void UVoxelManager::ApplyClusterMesh(FChunkCluster& Cluster, FVoxelClusterBuildResult& Result)
+{
+	UVoxelCluster* Component = Cluster.Component.Get();
+	if (!Component)
+	{
+		Component = NewObject<UVoxelCluster>(GetOwner());
+		Component->RegisterComponent();
+		Component->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
+		Component->SetRelativeLocation(Cluster.LocalBounds.GetCenter());
+		if (const UVoxelChunk* FirstMember = Cluster.Members[0].Get())
+		{
+			Component->SetMaterial(0, FirstMember->GetMaterial(0));
+		}
+		Cluster.Component = Component;
+	}
+
+	Component->ApplyMesh(MoveTemp(Result.Mesh));
+	Component->SetVisibility(true);
+
+	// 숨긴 멤버 Chunk도 충돌 / Density Query는 그대로 처리
+	for (const TWeakObjectPtr<UVoxelChunk>& Member : Cluster.Members)
+	{
+		if (UVoxelChunk* Chunk = Member.Get())
+		{
+			Chunk->SetVisibility(false);
+		}
+	}
+
+	Cluster.bMerged = true;
+	INC_DWORD_STAT(STAT_VoxelMergedClusters);
+}
+
+void UVoxelManager::SplitCluster(FChunkCluster& Cluster)
+{
+	++Cluster.Revision;
+	if (!Cluster.bMerged)
+		return;
+
+	for (const TWeakObjectPtr<UVoxelChunk>& Member : Cluster.Members)
+	{
+		if (UVoxelChunk* Chunk = Member.Get())
+		{
+			Chunk->SetVisibility(true);
+		}
+	}
+
+	if (UVoxelCluster* Component = Cluster.Component.Get())
+	{
+		Component->SetVisibility(false);
+		Component->ReleaseMesh();
+	}
+
+	Cluster.bMerged = false;
+	DEC_DWORD_STAT(STAT_VoxelMergedClusters);
+}
+
+void UVoxelManager::RequestCollisionCook(UVoxelChunk* Chunk)
+{
+	if (!IsValid(Chunk) || Chunk->bQueuedForCollisionCook)
+		return;
+
+	Chunk->bQueuedForCollisionCook = true;
+	CollisionCookQueue.Add(Chunk);
+	INC_DWORD_STAT(STAT_VoxelCollisionQueueDepth);
+}
+
+void UVoxelManager::UpdateChunkCollisionRange()
+{
+	CachedPawnLocations.Reset();
+	if (UWorld* World = GetWorld())
+	{
+		for (TActorIterator<APawn> It(World); It; ++It)
+		{
+			CachedPawnLocations.Add(It->GetActorLocation());
+		}
+	}
+
+	// Pawn 없이 Replay / Benchmark 할 때도 기준 위치 주변은 충돌을 생성
+	if (ReferenceLocationOverride.IsSet())
+	{
+		CachedPawnLocations.Add(ReferenceLocationOverride.GetValue());
+	}
+
+	// Chunk 중심 기준이므로 Chunk 대각선 절반만큼 반경을 넓혀서 검사
+	const float HalfDiagonal = CellSize * CellNum * 0.5f * UE_SQRT_3;
+	const float RadiusSquared = FMath::Square(CollisionRadius + HalfDiagonal);
+
+	for (auto& Pair : ChunkMap)
+	{
+		UVoxelChunk* Chunk = Pair.Value;
+		if (!IsValid(Chunk))
+			continue;
+
+		const FVector ChunkLocation = Chunk->GetComponentLocation();
+		bool bInRange = false;
+		for (const FVector& PawnLocation : CachedPawnLocations)
+		{
+			if (FVector::DistSquared(PawnLocation, ChunkLocation) <= RadiusSquared)
+			{
+				bInRange = true;
+				break;
+			}
+		}
+
+		Chunk->SetCollisionActive(bInRange);
+		if (bInRange && Chunk->IsDensityReleased() && !bRenderFree)
+		{
+			RequestDensityReload(Chunk);
+		}
 	}
 }
 
+void UVoxelManager::RequestDensityReload(UVoxelChunk* Chunk)
+{
+	// LOD 변경 Build가 진행 중이면 그 결과로 Density가 채워짐
+	const FIntVector ChunkIndex = Chunk->GetChunkInfo().ChunkIndex;
+	if (PendingDensityLoads.Contains(ChunkIndex) || Chunk->GetRequestedLODLevel() != Chunk->GetCurrentLODLevel())
+		return;
+
+	PendingDensityLoads.Add(ChunkIndex);
+	INC_DWORD_STAT(STAT_VoxelDensityReloads);
+	EnqueueGenerateChunk(Chunk, Chunk->MakeChunkSettingInfoForLOD(Chunk->GetCurrentLODLevel()), nullptr);
+}
+
+void UVoxelManager::UpdateSharedMemory()
+{
+	const int64 PoolBytes = ResultPool->GetPooledBytes();
+
+	int64 SculptBytes = 0;
+	{
+		FScopeLock ScopeLock(&SculptedDensityLock);
+		SculptBytes = SculptedDensityMap.GetAllocatedSize();
+		for (const TPair<FIntVector, FChunkSculptOverrides>& Pair : SculptedDensityMap)
+		{
+			SculptBytes += Pair.Value.VertexDensities.GetAllocatedSize();
+		}
+	}
+
+	int64 ClusterBytes = 0;
+	auto AddClusterMesh = [&ClusterBytes](const UVoxelCluster* Component)
+	{
+		if (IsValid(Component))
+		{
+			Component->ProcessMesh([&ClusterBytes](const UE::Geometry::FDynamicMesh3& Mesh)
+			{
+				ClusterBytes += UVoxelChunk::EstimateDynamicMeshBytes(Mesh);
+			});
+		}
+	};
+	for (const TPair<FIntVector, FChunkCluster>& Pair : Clusters)
+	{
+		AddClusterMesh(Pair.Value.Component.Get());
+	}
+	for (const TPair<FIntVector, FStartupShellRegion>& Pair : StartupShellRegions)
+	{
+		AddClusterMesh(Pair.Value.Component.Get());
+	}
+
+	// 끝난 Batch는 정리, 이웃이 복사해 간 Snapshot은 Task가 끝나면 같이 해제되므로 공개 중인 크기만 셈
+	int64 BatchBytes = 0;
+	for (int32 i = LiveDensityBatches.Num() - 1; i >= 0; --i)
+	{
+		if (const TSharedPtr<FVoxelDensityBatch, ESPMode::ThreadSafe> Batch = LiveDensityBatches[i].Pin())
+		{
+			BatchBytes += Batch->GetPublishedBytes();
+		}
+		else
+		{
+			LiveDensityBatches.RemoveAtSwap(i, EAllowShrinking::No);
+		}
+	}
+
+	SET_MEMORY_STAT(STAT_VoxelResultPoolMemory, PoolBytes);
+	SET_MEMORY_STAT(STAT_VoxelSculptRecordMemory, SculptBytes);
+	SET_MEMORY_STAT(STAT_VoxelClusterMeshMemory, ClusterBytes);
+	SET_MEMORY_STAT(STAT_VoxelDensityBatchMemory, BatchBytes);
+	SharedMemoryBytes = PoolBytes + SculptBytes + ClusterBytes + BatchBytes;
+}
+
+void UVoxelManager::EnforceMemoryBudget(const FVector& ReferenceLocation)
+{
+	UpdateSharedMemory();
+
+	const int64 BudgetBytes = static_cast<int64>(MemoryBudgetMB) * 1024 * 1024;
+	SET_MEMORY_STAT(STAT_VoxelMemoryBudget, BudgetBytes);
+	if (BudgetBytes <= 0 || GetMemoryBytes() <= BudgetBytes)
+	{
+		bOverMemoryBudget = false;
+		return;
+	}
+
+	// 0) Pool에 보관 중인 재사용 버퍼, 버려도 다음 Build가 새로 할당할 뿐이므로 가장 먼저 정리
+	const int64 PoolTargetBytes = FMath::Max<int64>(0, ResultPool->GetPooledBytes() - (GetMemoryBytes() - BudgetBytes));
+	SharedMemoryBytes -= ResultPool->Trim(PoolTargetBytes);
+	SET_MEMORY_STAT(STAT_VoxelResultPoolMemory, ResultPool->GetPooledBytes());
+
+	// 시작 Shell 교체가 끝나기 전에는 첫 Build 판정이 섞이므로 정리하지 않음
+	if (StartupShellRegions.Num() > 0)
+		return;
+
+	// 충돌이 꺼진 Chunk만 대상, 먼 Chunk부터 정리
+	TArray<UVoxelChunk*> Candidates;
+	for (auto& Pair : ChunkMap)
+	{
+		UVoxelChunk* Chunk = Pair.Value;
+		if (IsValid(Chunk) && !Chunk->IsCollisionActive())
+		{
+			Candidates.Add(Chunk);
+		}
+	}
+	Candidates.Sort([&ReferenceLocation](const UVoxelChunk& A, const UVoxelChunk& B)
+	{
+		return FVector::DistSquared(ReferenceLocation, A.GetComponentLocation()) > FVector::DistSquared(ReferenceLocation, B.GetComponentLocation());
+	});
+
+	// 1) Render Mesh와 중복인 CachedMeshData, 필요하면 Render Mesh에서 복원 가능
+	for (UVoxelChunk* Chunk : Candidates)
+	{
+		if (GetMemoryBytes() <= BudgetBytes)
+			break;
+
+		if (!Chunk->IsMeshDataReleased() && Chunk->GetMemory().MeshDataBytes > 0)
+		{
+			Chunk->ReleaseMeshData();
+			INC_DWORD_STAT(STAT_VoxelMeshDataReleases);
+		}
+	}
+
+	// 2) Sculpt되지 않은 Chunk의 Density, Query / Raycast는 절차적 Density와 같은 값을 얻고 Sculpt / 충돌 때 다시 Build
+	for (UVoxelChunk* Chunk : Candidates)
+	{
+		if (GetMemoryBytes() <= BudgetBytes)
+			break;
+
+		const FIntVector ChunkIndex = Chunk->GetChunkInfo().ChunkIndex;
+		const bool bBuildPending = PendingDensityLoads.Contains(ChunkIndex) || Chunk->GetRequestedLODLevel() != Chunk->GetCurrentLODLevel();
+		if (!Chunk->HasDensityData() || bBuildPending || GetSculptHash(ChunkIndex) != 0 || DeferredSculptOps.Contains(ChunkIndex))
+			continue;
+
+		Chunk->ReleaseDensityData();
+		INC_DWORD_STAT(STAT_VoxelDensityEvictions);
+	}
+
+	// 3) 남은 메모리가 Sculpt된 Chunk나 Pawn 주변 Chunk뿐이면 더 줄일 수 없으므로 한 번만 알림
+	const bool bStillOver = GetMemoryBytes() > BudgetBytes;
+	if (bStillOver && !bOverMemoryBudget)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[VoxelManagerComponent] Voxel memory %.1f MB exceeds budget %d MB after eviction"),
+			GetMemoryBytes() / (1024.0 * 1024.0), MemoryBudgetMB);
+	}
+	bOverMemoryBudget = bStillOver;
+}
+
+int32 UVoxelManager::UpdateServerChunkResidency()
+{
+	// UpdateChunkCollisionRange에서 모은 Pawn 위치 사용, Chunk 중심 기준이므로 Chunk 대각선 절반만큼 반경을 넓혀서 검사
+	const float HalfDiagonal = CellSize * CellNum * 0.5f * UE_SQRT_3;
+	const float Radius = FMath::Max(ServerDensityRadius, CollisionRadius) + HalfDiagonal;
+	const float RadiusSquared = FMath::Square(Radius);
+	auto IsInRange = [this, RadiusSquared](const FVector& ChunkLocation)
+	{
+		return CachedPawnLocations.ContainsByPredicate([&](const FVector& PawnLocation)
+		{
+			return FVector::DistSquared(PawnLocation, ChunkLocation) <= RadiusSquared;
+		});
+	};
+
+	// 범위를 벗어난 Chunk는 Component째 제거
+	// Sculpt된 Chunk는 절차적 Density로 Query할 수 없으므로 계속 유지, Build 중이면 도착한 뒤에 다시 판단
+	TArray<TPair<FIntVector, UVoxelChunk*>> ReleasedChunks;
+	for (auto& Pair : ChunkMap)
+	{
+		UVoxelChunk* Chunk = Pair.Value;
+		if (!IsValid(Chunk) || IsInRange(Chunk->GetComponentLocation()))
+			continue;
+
+		if (!Chunk->IsCollisionActive() && !PendingDensityLoads.Contains(Pair.Key) && GetSculptHash(Pair.Key) == 0)
+		{
+			ReleasedChunks.Emplace(Pair.Key, Chunk);
+		}
+	}
+
+	if (ReleasedChunks.Num() > 0)
+	{
+		{
+			FWriteScopeLock WriteLock(ChunkMapLock);
+			for (const TPair<FIntVector, UVoxelChunk*>& Released : ReleasedChunks)
+			{
+				ChunkMap.Remove(Released.Key);
+			}
+		}
+		for (const TPair<FIntVector, UVoxelChunk*>& Released : ReleasedChunks)
+		{
+			Released.Value->DestroyComponent();
+		}
+	}
+
+	// Pawn 주변 Chunk Index 범위만 훑어서 없는 Component는 만들고 Density를 올림
+	const float ChunkSize = static_cast<float>(CellSize) * CellNum;
+	const FVector VoxelMin(-ChunkSize * ChunkNum * 0.5f);
+	TArray<UVoxelChunk*> LoadRequests;
+	for (const FVector& PawnLocation : CachedPawnLocations)
+	{
+		const FVector GridPosition = (GetComponentTransform().InverseTransformPosition(PawnLocation) - VoxelMin) / ChunkSize;
+		const float GridRadius = Radius / ChunkSize;
+		const FIntVector Start(
+			FMath::Max(FMath::FloorToInt(GridPosition.X - GridRadius), 0),
+			FMath::Max(FMath::FloorToInt(GridPosition.Y - GridRadius), 0),
+			FMath::Max(FMath::FloorToInt(GridPosition.Z - GridRadius), 0));
+		const FIntVector End(
+			FMath::Min(FMath::FloorToInt(GridPosition.X + GridRadius), ChunkNum - 1),
+			FMath::Min(FMath::FloorToInt(GridPosition.Y + GridRadius), ChunkNum - 1),
+			FMath::Min(FMath::FloorToInt(GridPosition.Z + GridRadius), ChunkNum - 1));
+
+		for (int32 x = Start.X; x <= End.X; ++x)
+			for (int32 y = Start.Y; y <= End.Y; ++y)
+				for (int32 z = Start.Z; z <= End.Z; ++z)
+				{
+					const FIntVector ChunkIndex(x, y, z);
+					if (FVector::DistSquared(PawnLocation, GetChunkWorldLocation(ChunkIndex)) > RadiusSquared)
+						continue;
+
+					UVoxelChunk* Chunk = GetChunk(ChunkIndex);
+					if (!Chunk)
+					{
+						Chunk = CreateChunkComponent(MakeResidentChunkInfo(ChunkIndex));
+					}
+
+					if (!Chunk->HasDensityData() && !PendingDensityLoads.Contains(ChunkIndex))
+					{
+						PendingDensityLoads.Add(ChunkIndex);
+						LoadRequests.Add(Chunk);
+					}
+				}
+	}
+
+	if (LoadRequests.Num() == 0)
+		return 0;
+
+	const TSharedPtr<FVoxelDensityBatch, ESPMode::ThreadSafe> Batch = MakeShared<FVoxelDensityBatch, ESPMode::ThreadSafe>();
+	LiveDensityBatches.Add(Batch);
+	for (const UVoxelChunk* Chunk : LoadRequests)
+	{
+		Batch->AddChunk(Chunk->GetChunkInfo().ChunkIndex);
+	}
+
+	for (UVoxelChunk* Chunk : LoadRequests)
+	{
+		EnqueueGenerateChunk(Chunk, Chunk->MakeChunkSettingInfoForLOD(1), Batch);
+	}
+	return LoadRequests.Num();
+}
+
+FChunkSettingInfo UVoxelManager::MakeResidentChunkInfo(const FIntVector& ChunkIndex) const
+{
+	FChunkSettingInfo ChunkInfo{ ChunkIndex, CellSize, CellNum, ChunkNum, 1, GetDensityApron(), DensityLayout, MesherType };
+	ChunkInfo.Calculate();
+	return ChunkInfo;
+}
+
+void UVoxelManager::ProcessCollisionCookQueue()
+{
+	if (CollisionCookQueue.Num() == 0)
+		return;
+
+	const double Now = FPlatformTime::Seconds();
+	const FVector ReferenceLocation = GetReferenceLocation();
+
+	// 가까운 Chunk부터 Cooking
+	const int32 RemovedCount = CollisionCookQueue.RemoveAll([](const TWeakObjectPtr<UVoxelChunk>& Chunk) { return !Chunk.IsValid(); });
+	DEC_DWORD_STAT_BY(STAT_VoxelCollisionQueueDepth, RemovedCount);
+	CollisionCookQueue.Sort([&ReferenceLocation](const TWeakObjectPtr<UVoxelChunk>& A, const TWeakObjectPtr<UVoxelChunk>& B)
+	{
+		return FVector::DistSquared(ReferenceLocation, A->GetComponentLocation()) < FVector::DistSquared(ReferenceLocation, B->GetComponentLocation());
+	});
+
+	int32 CookedCount = 0;
+	for (int32 i = 0; i < CollisionCookQueue.Num(); )
+	{
+		UVoxelChunk* Chunk = CollisionCookQueue[i].Get();
+		if (!Chunk->IsCollisionActive() || !Chunk->IsCollisionDirty())
+		{
+			Chunk->bQueuedForCollisionCook = false;
+			CollisionCookQueue.RemoveAt(i, 1, EAllowShrinking::No);
+			DEC_DWORD_STAT(STAT_VoxelCollisionQueueDepth);
+			continue;
+		}
+
+		const bool bSettled = Now - Chunk->GetLastCollisionDirtyTime() >= CollisionCoalesceDelay;
+		const bool bOverdue = Now - Chunk->GetFirstCollisionDirtyTime() >= CollisionMaxLatency;
+		if (!bSettled && !bOverdue)
+		{
+			++i;
+			continue;
+		}
+
+		const bool bReachedCookLimit = MaxCollisionCooksPerFrame > 0 && CookedCount >= MaxCollisionCooksPerFrame;
+		if (bReachedCookLimit)
+			break;
+
+		Chunk->CookCollision(CollisionLODLevel);
+		Chunk->bQueuedForCollisionCook = false;
+		CollisionCookQueue.RemoveAt(i, 1, EAllowShrinking::No);
+		DEC_DWORD_STAT(STAT_VoxelCollisionQueueDepth);
+		++CookedCount;
+	}
+
+	INC_DWORD_STAT_BY(STAT_VoxelCollisionCooksPerFrame, CookedCount);
+}
+
+bool UVoxelManager::Raycast(const FVector& Start, const FVector& End, FVoxelRaycastHit& OutHit) const
+{
+	VOXEL_SCOPE_STAGE(Raycast);
+
+	OutHit = FVoxelRaycastHit();
+
+	if (ChunkNum <= 0 || CellNum <= 0 || CellSize <= 0)
+		return false;
+
+	const FVector Delta = End - Start;
+	const float RayLength = Delta.Size();
+	if (RayLength <= UE_KINDA_SMALL_NUMBER)
+		return false;
+
+	const FVector Dir = Delta / RayLength;
+	const float ChunkSize = static_cast<float>(CellSize * CellNum);
+	const float VoxelSize = ChunkSize * ChunkNum;
+	const FVector VoxelMinCorner = GetComponentLocation() - FVector(VoxelSize) * 0.5f;
+
+	// Voxel 범위 밖 구간은 잘라냄
+	float TEnter = 0.0f;
+	float TExit = RayLength;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const float Min = VoxelMinCorner[Axis];
+		const float Max = Min + VoxelSize;
+		if (FMath::Abs(Dir[Axis]) <= UE_SMALL_NUMBER)
+		{
+			if (Start[Axis] < Min || Start[Axis] > Max)
+				return false;
+			continue;
+		}
+
+		float TA = (Min - Start[Axis]) / Dir[Axis];
+		float TB = (Max - Start[Axis]) / Dir[Axis];
+		if (TA > TB)
+			Swap(TA, TB);
+
+		TEnter = FMath::Max(TEnter, TA);
+		TExit = FMath::Min(TExit, TB);
+	}
+
+	if (TEnter > TExit)
+		return false;
+
+	auto FinishHit = [&](float HitT, const FIntVector& ChunkIndex)
+	{
+		OutHit.bBlockingHit = true;
+		OutHit.Distance = HitT;
+		OutHit.ImpactPoint = Start + Dir * HitT;
+		OutHit.ImpactNormal = -SampleDensityGradient(OutHit.ImpactPoint).GetSafeNormal();
+		OutHit.Chunk = ChunkMap.FindRef(ChunkIndex);
+	};
+
+	float PrevT = TEnter;
+	float PrevDensity = SampleDensity(Start + Dir * TEnter);
+
+	// Density가 양수면 Solid, 음수 -> 양수로 바뀌는 첫 지점이 표면
+	return TraverseGrid(Start, Dir, VoxelMinCorner, ChunkSize, ChunkNum, TEnter, TExit,
+		[&](const FIntVector& ChunkIndex, float ChunkT0, float ChunkT1) -> bool
+		{
+			if (PrevDensity >= 0.0f)
+			{
+				FinishHit(PrevT, ChunkIndex);
+				return true;
+			}
+
+			const FVector ChunkMinCorner = VoxelMinCorner + FVector(ChunkIndex) * ChunkSize;
+			auto VisitCell = [&](const FIntVector& CellIndex, float CellT0, float CellT1) -> bool
+			{
+				const float Density = SampleDensity(Start + Dir * CellT1);
+				if (Density < 0.0f)
+				{
+					PrevT = CellT1;
+					PrevDensity = Density;
+					return false;
+				}
+
+				// Cell 안에서는 Density가 삼선형이므로 이분 탐색으로 교차점 보정
+				float EmptyT = PrevT;
+				float SolidT = CellT1;
+				for (int32 Iteration = 0; Iteration < 8; ++Iteration)
+				{
+					const float MidT = (EmptyT + SolidT) * 0.5f;
+					if (SampleDensity(Start + Dir * MidT) < 0.0f)
+						EmptyT = MidT;
+					else
+						SolidT = MidT;
+				}
+
+				FinishHit(SolidT, ChunkIndex);
+				return true;
+			};
+
+			// 생성이 끝난 Chunk는 Brick 단위로 먼저 진행하면서 전부 빈 Brick은 Cell 검사 없이 통과
+			const UVoxelChunk* Chunk = ChunkMap.FindRef(ChunkIndex);
+			if (!IsValid(Chunk) || !Chunk->HasDensityData() || !Chunk->GetBrickMinMax().IsValid())
+			{
+				return TraverseGrid(Start, Dir, ChunkMinCorner, static_cast<float>(CellSize), CellNum, ChunkT0, ChunkT1, VisitCell);
+			}
+
+			const FVoxelBrickMinMax& BrickMinMax = Chunk->GetBrickMinMax();
+			const float BrickExtent = static_cast<float>(CellSize * FVoxelBrickMinMax::BrickSize);
+			return TraverseGrid(Start, Dir, ChunkMinCorner, BrickExtent, BrickMinMax.BrickNum, ChunkT0, ChunkT1,
+				[&](const FIntVector& BrickIndex, float BrickT0, float BrickT1) -> bool
+				{
+					float BrickMax;
+					{
+						FReadScopeLock ReadLock(Chunk->GetDensityLock());
+						BrickMax = BrickMinMax.Max[BrickMinMax.GetBrickIndex(BrickIndex.X, BrickIndex.Y, BrickIndex.Z)];
+					}
+
+					if (BrickMax < 0.0f)
+					{
+						PrevT = BrickT1;
+						PrevDensity = BrickMax;
+						return false;
+					}
+
+					const FVector BrickMinCorner = ChunkMinCorner + FVector(BrickIndex) * BrickExtent;
+					return TraverseGrid(Start, Dir, BrickMinCorner, static_cast<float>(CellSize), FVoxelBrickMinMax::BrickSize, BrickT0, BrickT1,
+						[&](const FIntVector& LocalCellIndex, float CellT0, float CellT1) -> bool
+						{
+							return VisitCell(BrickIndex * FVoxelBrickMinMax::BrickSize + LocalCellIndex, CellT0, CellT1);
+						});
+				});
+		});
+}
+
+float UVoxelManager::SampleDensity(const FVector& WorldPosition) const
+{
+	const int32 VoxelSize = CellSize * CellNum * ChunkNum;
+	const FVector VoxelMinCorner = GetComponentLocation() - FVector(VoxelSize) * 0.5f;
+	const FVector GridPosition = (WorldPosition - VoxelMinCorner) / CellSize;
+
+	const FIntVector ChunkIndex(
+		FMath::Clamp(FMath::FloorToInt(GridPosition.X / CellNum), 0, ChunkNum - 1),
+		FMath::Clamp(FMath::FloorToInt(GridPosition.Y / CellNum), 0, ChunkNum - 1),
+		FMath::Clamp(FMath::FloorToInt(GridPosition.Z / CellNum), 0, ChunkNum - 1));
+
+	// 생성이 끝난 Chunk는 Sculpt 결과가 반영된 Density 사용, 나머지는 절차적 Density
+	const UVoxelChunk* Chunk = ChunkMap.FindRef(ChunkIndex);
+	if (IsValid(Chunk) && Chunk->HasDensityData())
+	{
+		return Chunk->SampleDensity(GridPosition - FVector(ChunkIndex * CellNum));
+	}
+
+	return UVoxelChunk::EvaluateProceduralDensity(WorldPosition - GetComponentLocation(), VoxelSize);
+}
+
+FVector UVoxelManager::SampleDensityGradient(const FVector& WorldPosition) const
+{
+	const float H = CellSize * 0.5f;
+	return FVector(
+		SampleDensity(WorldPosition + FVector(H, 0, 0)) - SampleDensity(WorldPosition - FVector(H, 0, 0)),
+		SampleDensity(WorldPosition + FVector(0, H, 0)) - SampleDensity(WorldPosition - FVector(0, H, 0)),
+		SampleDensity(WorldPosition + FVector(0, 0, H)) - SampleDensity(WorldPosition - FVector(0, 0, H))) / (2.0f * H);
+}
+
+void UVoxelManager::QueryDensity(TConstArrayView<FVector> WorldPositions, TArray<FVoxelDensitySample>& OutSamples) const
+{
+	VOXEL_SCOPE_STAGE(QueryDensity);
+
+	OutSamples.SetNum(WorldPositions.Num());
+	if (WorldPositions.Num() == 0 || ChunkNum <= 0 || CellNum <= 0 || CellSize <= 0)
+		return;
+
+	const int32 VoxelSize = CellSize * CellNum * ChunkNum;
+	const float InvCellSize = 1.0f / CellSize;
+
+	FReadScopeLock MapReadLock(ChunkMapLock);
+	const FVector Origin = QueryOrigin;
+	const FVector VoxelMinCorner = Origin - FVector(VoxelSize) * 0.5f;
+
+	// 1) 전체 Batch의 Cell 좌표와 Chunk Key를 먼저 계산
+	TArray<FVector> GridPositions;
+	TArray<int32> ChunkKeys;
+	TArray<int32> Order;
+	GridPositions.SetNumUninitialized(WorldPositions.Num());
+	ChunkKeys.SetNumUninitialized(WorldPositions.Num());
+	Order.SetNumUninitialized(WorldPositions.Num());
+
+	for (int32 i = 0; i < WorldPositions.Num(); ++i)
+	{
+		const FVector GridPosition = (WorldPositions[i] - VoxelMinCorner) * InvCellSize;
+		const int32 X = FMath::FloorToInt(GridPosition.X / CellNum);
+		const int32 Y = FMath::FloorToInt(GridPosition.Y / CellNum);
+		const int32 Z = FMath::FloorToInt(GridPosition.Z / CellNum);
+		const bool bInside = X >= 0 && Y >= 0 && Z >= 0 && X < ChunkNum && Y < ChunkNum && Z < ChunkNum;
+
+		GridPositions[i] = GridPosition;
+		ChunkKeys[i] = bInside ? X + (Y + Z * ChunkNum) * ChunkNum : INDEX_NONE;
+		Order[i] = i;
+	}
+
+	// 2) 같은 Chunk끼리 묶어서 Chunk Lock을 한 번만 잡고 연속으로 처리
+	Algo::SortBy(Order, [&ChunkKeys](int32 Index) { return ChunkKeys[Index]; });
+
+	for (int32 GroupStart = 0; GroupStart < Order.Num(); )
+	{
+		const int32 Key = ChunkKeys[Order[GroupStart]];
+		int32 GroupEnd = GroupStart + 1;
+		while (GroupEnd < Order.Num() && ChunkKeys[Order[GroupEnd]] == Key)
+		{
+			++GroupEnd;
+		}
+
+		const UVoxelChunk* Chunk = nullptr;
+		FIntVector ChunkIndex = FIntVector::ZeroValue;
+		if (Key != INDEX_NONE)
+		{
+			ChunkIndex = FIntVector(Key % ChunkNum, (Key / ChunkNum) % ChunkNum, Key / (ChunkNum * ChunkNum));
+			Chunk = ChunkMap.FindRef(ChunkIndex);
+		}
+
+		// 같은 Chunk의 샘플은 4개씩 SoA로 묶어서 SIMD로 계산
+		const TConstArrayView<int32> GroupIndices(Order.GetData() + GroupStart, GroupEnd - GroupStart);
+		bool bResident = false;
+		if (IsValid(Chunk))
+		{
+			FReadScopeLock DensityReadLock(Chunk->GetDensityLock());
+			if (Chunk->HasDensityData())
+			{
+				bResident = true;
+				Chunk->SampleDensityAndGradientBatch(GroupIndices, GridPositions, FVector(ChunkIndex * CellNum), OutSamples);
+			}
+		}
+
+		// 3) 생성되지 않은 영역은 절차적 Density와 중심 차분 Gradient
+		if (!bResident)
+		{
+			UVoxelChunk::EvaluateProceduralSamples(GroupIndices, WorldPositions, Origin, CellSize * 0.5f, VoxelSize, OutSamples);
+		}
+
+		GroupStart = GroupEnd;
+	}
+}
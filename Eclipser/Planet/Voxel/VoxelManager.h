@@ -3,9 +3,16 @@
 #include "CoreMinimal.h"
 #include "Components/SceneComponent.h"
 #include "Defines/VoxelStructs.h"
+#include "VoxelCluster.h"
+#include "etc/VoxelDigRecording.h"
+#include "etc/VoxelSculptCodec.h"
 #include "VoxelManager.generated.h"
 
 class UVoxelChunk;
+class FVoxelDensityBatch;
+class FVoxelBuildResultPool;
+class FVoxelChunkCache;
+class FVoxelCookedPlanet;
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class ECLIPSER_API UVoxelManager : public USceneComponent
@@ -26,6 +33,7 @@ public:
 	                           FActorComponentTickFunction* ThisTickFunction) override;
 
 	void RegisterChunk(const FIntVector& Index, UVoxelChunk* Chunk);
+	int32 GetChunkCount() const { return ChunkMap.Num(); }
 	UVoxelChunk* GetChunk(const FIntVector& Index);
 
 	UPROPERTY(EditAnywhere, Category="Voxel")
@@ -34,25 +42,125 @@ public:
 	int CellNum;
 	UPROPERTY(EditAnywhere, Category="Voxel")
 	int ChunkNum;
+	// Chunk 경계 밖으로 추가 저장하는 꼭짓점 수 (Gradient Normal 계산에 최소 1 필요, Dual Mesher는 LOD 설정에 맞춰 자동으로 올림)
+	UPROPERTY(EditAnywhere, Category="Voxel", meta=(ClampMin="1", UIMin="1"))
+	int DensityApron = 1;
+	// Density 배열 배치, Tiled는 큰 LOD Step Meshing과 Sculpt 영역 접근의 Cache 효율이 좋음
+	UPROPERTY(EditAnywhere, Category="Voxel")
+	EVoxelDensityLayout DensityLayout = EVoxelDensityLayout::Linear;
+	UPROPERTY(EditAnywhere, Category="Voxel")
+	EVoxelMesherType MesherType = EVoxelMesherType::MarchingCubes;
 
 	void Sculpt(const FVector& ImpactPoint, float Radius);
 	void RecordSculptedDensity(const FChunkSettingInfo& Info, int32 LocalX, int32 LocalY, int32 LocalZ, float Density);
 	void ApplySculptedDensityOverrides(const FChunkSettingInfo& Info, TArray<FVertexDensity>& DensityData);
+	// CookedPlanetPath가 현재 설정과 맞는 파일이면 유효, BeginPlay 이후 바뀌지 않으므로 어느 스레드에서든 호출 가능
+	TSharedPtr<const FVoxelCookedPlanet, ESPMode::ThreadSafe> GetCookedPlanet() const { return CookedPlanet; }
+	// Chunk에 기록된 Sculpt 내용의 Hash, Sculpt가 없으면 0 (디스크 Cache Key), 어느 스레드에서든 호출 가능
+	uint32 GetSculptHash(const FIntVector& ChunkIndex) const;
+
+	/* Network (UVoxelNetComponent) */
+	float GetMaxNetSculptRadius() const { return MaxNetSculptRadius; }
+	FVector GetChunkWorldLocation(const FIntVector& ChunkIndex) const;
+	// Client에서 호출, 서버가 확정한 연산을 그대로 적용
+	void ApplyNetSculptBatch(const TArray<uint8>& Batch);
+	// Client에서 호출, 늦게 들어왔을 때 받은 Chunk Sculpt 기록을 현재 기록과 최소값으로 병합
+	void ApplyNetSculptSnapshot(const FIntVector& ChunkIndex, TConstArrayView<TPair<int32, FFloat16>> Overrides);
+	void GetSculptedChunkIndices(TArray<FIntVector>& OutChunkIndices) const;
+	void GetSortedSculptOverrides(const FIntVector& ChunkIndex, TArray<TPair<int32, FFloat16>>& OutOverrides) const;
+
+	void RequestCollisionCook(UVoxelChunk* Chunk);
+	// Chunk Mesh가 바뀌면 호출, 합쳐진 Cluster를 풀고 다시 안정될 때까지 합치지 않음
+	void NotifyChunkMeshChanged(UVoxelChunk* Chunk);
+
+	// Physics 없이 Density 필드에 대해 Ray 검사 (Chunk 3D DDA -> Cell 3D DDA -> 보간으로 교차점 보정)
+	bool Raycast(const FVector& Start, const FVector& End, FVoxelRaycastHit& OutHit) const;
+
+	// 여러 World 좌표의 Density/Gradient/Material을 한 번에 조회, 어느 스레드에서든 호출 가능
+	// 생성된 Chunk는 Sculpt가 반영된 데이터를, 나머지 영역은 절차적 Density를 사용
+	void QueryDensity(TConstArrayView<FVector> WorldPositions, TArray<FVoxelDensitySample>& OutSamples) const;
+
+	/* Benchmark / Replay */
+	// Render-Free 모드는 시작 시 Pawn(또는 기준 위치) 주변에서 요청한 Chunk만 대상, 주변에 아무 것도 없으면 바로 완료
+	bool IsInitialBuildComplete() const { return (TotalChunkCount > 0 || bRenderFree) && CompletedChunkCount >= TotalChunkCount; }
+	double GetInitialBuildTimeMs() const { return InitialBuildTimeMs; }
+	// 시작 후 처음으로 Shell이나 Chunk Mesh가 보인 시간
+	double GetFirstVisibleTimeMs() const { return FirstVisibleTimeMs; }
+	void SetLODDistanceLevels(const TArray<FLODDistanceLevel>& InLevels) { LODDistanceLevels = InLevels; }
+	void SetChunkProcessingBudget(int32 InMaxChunksPerFrame, float InTimeBudgetMs);
+	// BeginPlay 전에 호출해야 적용됨
+	void SetDiskCacheEnabled(bool bEnabled) { bUseDiskCache = bEnabled; }
+	// BeginPlay 전에 호출해야 적용됨, Dedicated Server가 아니어도 Render 없는 Server 모드로 실행 (Listen Server / Benchmark / Test)
+	void SetRenderFree(bool bEnabled) { bForceRenderFree = bEnabled; }
+	// Render Mesh 없이 Density와 Pawn 주변 Collision만 유지하는 Server 모드
+	bool IsRenderFree() const { return bRenderFree; }
+	void SetServerDensityRadius(float InRadius) { ServerDensityRadius = FMath::Max(0.0f, InRadius); }
+	void SetCollisionRadius(float InRadius) { CollisionRadius = FMath::Max(0.0f, InRadius); }
+
+	/* Memory */
+	// Chunk가 UpdateMemoryStats에서 바뀐 크기만큼 호출
+	void AddAccountedMemory(int64 DeltaBytes) { AccountedMemoryBytes += DeltaBytes; }
+	// Chunk별 크기 + Result Pool / Sculpt 기록 / Cluster Mesh / Density Batch 공유 메모리
+	int64 GetMemoryBytes() const { return AccountedMemoryBytes + SharedMemoryBytes; }
+	bool IsOverMemoryBudget() const { return bOverMemoryBudget; }
+	void SetMemoryBudgetMB(int32 InBudgetMB) { MemoryBudgetMB = FMath::Max(0, InBudgetMB); }
+	// 설정하면 Player Pawn 대신 이 위치를 LOD / Collision 기준 위치로 사용
+	void SetReferenceLocationOverride(const TOptional<FVector>& InLocation) { ReferenceLocationOverride = InLocation; }
+	bool HasPendingBuilds() const { return CompletedQueueDepth.load(std::memory_order_relaxed) > 0 || BuildsInFlight.load(std::memory_order_relaxed) > 0; }
+	const FVoxelBuildResultPool& GetResultPool() const { return *ResultPool; }
+
+	/* Dig Recording / Replay */
+	void StartDigRecording();
+	// 기록을 파일로 저장하고 저장한 경로를 반환, Path가 비어 있으면 Saved/VoxelRecordings에 저장
+	FString StopDigRecording(const FString& Path = FString());
+	bool IsRecordingDig() const { return DigRecording.IsValid(); }
+	// Replay 중에는 기록된 경로를 기준 위치로 사용하고, 시작 시 Pipeline 통계를 초기화
+	void StartDigReplay(const TSharedRef<const FVoxelDigRecording>& Recording);
+	void StopDigReplay();
+	bool IsReplayingDig() const { return DigReplay.IsValid(); }
+	const FVoxelDigReplayStats& GetLastDigReplayStats() const { return LastDigReplayStats; }
 	
 private:
 	UPROPERTY(VisibleAnywhere, meta=(AllowPrivateAccess = true))
 	TMap<FIntVector, UVoxelChunk*> ChunkMap;
+	// Worker Thread의 QueryDensity와 Game Thread의 ChunkMap/Origin 변경 사이 동기화
+	mutable FRWLock ChunkMapLock;
+	FVector QueryOrigin = FVector::ZeroVector;
 	
 	void GenerateChunk();
-	void EnqueueGenerateChunk(UVoxelChunk* Chunk, const FChunkSettingInfo& ChunkInfo);
+	UVoxelChunk* CreateChunkComponent(const FChunkSettingInfo& ChunkInfo);
+	void ProcessChunkCreationQueue();
+	void EnqueueGenerateChunk(UVoxelChunk* Chunk, const FChunkSettingInfo& ChunkInfo,
+		const TSharedPtr<FVoxelDensityBatch, ESPMode::ThreadSafe>& Batch = nullptr);
 	void GenerateCompletedChunk();
-	void PushCompletedResult(FChunkBuildResult&& Result, const TWeakObjectPtr<UVoxelChunk>& Chunk, const FChunkSettingInfo& ChunkInfo);
+	void PushCompletedResult(TUniquePtr<FPendingChunkResult>&& Pending);
 
 	FVector GetReferenceLocation() const;
+
+	float SampleDensity(const FVector& WorldPosition) const;
+	FVector SampleDensityGradient(const FVector& WorldPosition) const;
 private:
 
-	TQueue<FPendingChunkResult, EQueueMode::Mpsc> CompletedChunkDataQueue;
+	TQueue<TUniquePtr<FPendingChunkResult>, EQueueMode::Mpsc> CompletedChunkDataQueue;
+	std::atomic<int32> CompletedQueueDepth{0};
+	int32 DiscardedBuildCount = 0;
+	// Task가 Manager보다 오래 살아있을 수 있으므로 공유 포인터로 보관
+	TSharedPtr<FVoxelBuildResultPool, ESPMode::ThreadSafe> ResultPool;
+	TSharedPtr<FVoxelChunkCache, ESPMode::ThreadSafe> ChunkCache;
+	// Saved/VoxelCache/<Owner 이름>에 Chunk별 Density와 Chunk / LOD별 Mesh를 저장해서 다음 실행이나 같은 LOD 재방문 시 재사용
+	UPROPERTY(EditAnywhere, Category="Voxel|Cache", meta=(AllowPrivateAccess=true))
+	bool bUseDiskCache = true;
+	// 폴더 크기 한도, 넘으면 오래 사용하지 않은 파일부터 삭제 (0이면 제한 없음)
+	UPROPERTY(EditAnywhere, Category="Voxel|Cache", meta=(AllowPrivateAccess=true, ClampMin=0))
+	int32 DiskCacheMaxMB = 512;
+	// VoxelBake Commandlet 결과 파일 (Content 기준 상대 경로), 패키징 시 DirectoriesToAlwaysStageAsNonUFS에 폴더 추가 필요
+	UPROPERTY(EditAnywhere, Category="Voxel|Cache", meta=(AllowPrivateAccess=true))
+	FString CookedPlanetPath;
+	TSharedPtr<const FVoxelCookedPlanet, ESPMode::ThreadSafe> CookedPlanet;
 	double BuildStartTime = 0.0;
+	double InitialBuildTimeMs = 0.0;
+	std::atomic<int32> BuildsInFlight{0};
+	TOptional<FVector> ReferenceLocationOverride;
 	int32 TotalChunkCount = 0;
 	int32 CompletedChunkCount = 0;
 	
@@ -63,9 +171,17 @@ private:
 	
 	bool bLoggedBuildTime = false;
 
+	// BeginPlay에서 Build만 먼저 보내고 Component는 거리순으로 나눠서 생성
+	TArray<FChunkSettingInfo> PendingChunkCreations;
+	int32 NextChunkCreation = 0;
+	UPROPERTY(EditAnywhere, Category="Voxel|Performance", meta=(ClampMin="0.0", UIMin="0.0", AllowPrivateAccess=true))
+	float ChunkCreationTimeBudgetMs = 1.0f;
+
 private:
 	/* LOD Settings */
 	int32 ComputeLODLevel(float Distance) const;
+	// SimplifyMinLODLevel 이상인 LOD만 해당 LOD 설정의 삼각형 예산을 사용
+	int32 ComputeTriangleBudget(int32 LODLevel) const;
 	void UpdateChunkLODLevels(const FVector& Vector);
 
 	float TimeSinceLastLODUpdate = 0.0f;
@@ -74,6 +190,155 @@ private:
 	TArray<FLODDistanceLevel> LODDistanceLevels;
 	UPROPERTY(EditAnywhere, Category="Voxel|LOD", meta=(ClampMin="0.0", UIMin="0.0", AllowPrivateAccess=true))
 	float LODUpdateInterval = 0.2f;
+	// 이 LOD Level부터 FLODDistanceLevel::TriangleBudget에 맞춰 Mesh 단순화
+	UPROPERTY(EditAnywhere, Category="Voxel|LOD", meta=(ClampMin="1", UIMin="1", AllowPrivateAccess=true))
+	int32 SimplifyMinLODLevel = 2;
+
+private:
+	/* Progressive Startup */
+	// 전체 Planet을 StartupShellRegionSize^3 Chunk 단위의 거친 Shell로 먼저 만들고, 영역의 Chunk가 모두 완성되면 교체
+	void BuildStartupShell();
+	void ProcessCompletedShellRegions();
+	void OnChunkFirstBuilt(const UVoxelChunk* Chunk);
+	void MarkFirstVisible();
+
+	struct FStartupShellRegion
+	{
+		TWeakObjectPtr<UVoxelCluster> Component;
+		FVector Center = FVector::ZeroVector; // Manager 기준
+		int32 PendingChunks = 0;
+	};
+	TMap<FIntVector, FStartupShellRegion> StartupShellRegions;
+	TQueue<TUniquePtr<FVoxelClusterBuildResult>, EQueueMode::Mpsc> CompletedShellQueue;
+	int32 ActiveShellRegionSize = 0;
+	double FirstVisibleTimeMs = 0.0;
+
+	UPROPERTY(EditAnywhere, Category="Voxel|Startup", meta=(AllowPrivateAccess=true))
+	bool bProgressiveStartup = true;
+	// Shell 영역 하나가 덮는 축별 Chunk 수, ChunkNum의 약수로 내림
+	UPROPERTY(EditAnywhere, Category="Voxel|Startup", meta=(ClampMin="2", UIMin="2", AllowPrivateAccess=true))
+	int32 StartupShellRegionSize = 4;
+	// Shell 영역 Meshing에 쓰는 LOD, 영역 Cell 크기는 CellSize * StartupShellRegionSize
+	UPROPERTY(EditAnywhere, Category="Voxel|Startup", meta=(ClampMin="1", UIMin="1", AllowPrivateAccess=true))
+	int32 StartupShellLODLevel = 2;
+
+private:
+	/* Cluster Settings */
+	void InitializeClusters();
+	void UpdateClusters(const FVector& ReferenceLocation);
+	void ProcessCompletedClusters();
+
+	struct FChunkCluster
+	{
+		TArray<TWeakObjectPtr<UVoxelChunk>> Members;
+		TWeakObjectPtr<UVoxelCluster> Component;
+		FBox LocalBounds = FBox(ForceInit); // Manager 기준
+		double LastChangeTime = 0.0;
+		// 멤버가 바뀔 때마다 증가, 진행 중이던 Build 결과를 버리는 기준
+		uint32 Revision = 0;
+		bool bMerged = false;
+		bool bBuildInFlight = false;
+	};
+	void LaunchClusterBuild(const FIntVector& ClusterIndex, FChunkCluster& Cluster);
+	void ApplyClusterMesh(FChunkCluster& Cluster, FVoxelClusterBuildResult& Result);
+	void SplitCluster(FChunkCluster& Cluster);
+
+	TMap<FIntVector, FChunkCluster> Clusters;
+	TQueue<TUniquePtr<FVoxelClusterBuildResult>, EQueueMode::Mpsc> CompletedClusterQueue;
+
+	// 축마다 이 수만큼의 Chunk를 하나의 Cluster Mesh로 합침, 1이면 사용 안 함
+	UPROPERTY(EditAnywhere, Category="Voxel|Cluster", meta=(ClampMin="1", UIMin="1", AllowPrivateAccess=true))
+	int32 ClusterSize = 2;
+	// 기준 위치에서 Cluster 영역까지의 거리가 이 값보다 멀 때만 합침
+	UPROPERTY(EditAnywhere, Category="Voxel|Cluster", meta=(ClampMin="0.0", UIMin="0.0", AllowPrivateAccess=true))
+	float ClusterMergeDistance = 8000.0f;
+	// 멤버 Chunk의 LOD 변경 / Sculpt 후 이 시간 동안 변화가 없어야 합침
+	UPROPERTY(EditAnywhere, Category="Voxel|Cluster", meta=(ClampMin="0.0", UIMin="0.0", AllowPrivateAccess=true))
+	float ClusterStableTime = 1.0f;
+
+private:
+	/* Collision Settings */
+	void UpdateChunkCollisionRange();
+	void ProcessCollisionCookQueue();
+
+	TArray<TWeakObjectPtr<UVoxelChunk>> CollisionCookQueue;
+	TArray<FVector> CachedPawnLocations;
+
+	/* Memory Budget */
+	// 예산을 넘으면 Result Pool을 비우고, 먼 Chunk부터 CachedMeshData를 버리고, 그래도 넘으면 Sculpt되지 않은 먼 Chunk의 Density를 버림
+	void EnforceMemoryBudget(const FVector& ReferenceLocation);
+	// Density를 버린 Chunk가 Sculpt / Collision 때문에 다시 필요하면 현재 LOD로 다시 Build
+	void RequestDensityReload(UVoxelChunk* Chunk);
+	// Chunk에 속하지 않는 메모리를 다시 계산해서 SharedMemoryBytes에 기록
+	void UpdateSharedMemory();
+	int64 AccountedMemoryBytes = 0;
+	int64 SharedMemoryBytes = 0;
+	// Task가 들고 있는 동안만 살아있으므로 약한 참조로 추적
+	TArray<TWeakPtr<FVoxelDensityBatch, ESPMode::ThreadSafe>> LiveDensityBatches;
+	bool bOverMemoryBudget = false;
+
+	// 모든 Chunk의 Density / Mesh / Collision / Render Mesh와 공유 메모리 합계 상한, 0이면 제한 없음
+	UPROPERTY(EditAnywhere, Category="Voxel|Memory", meta=(ClampMin="0", UIMin="0", AllowPrivateAccess=true))
+	int32 MemoryBudgetMB = 0;
+
+	/* Render-Free (Dedicated Server) */
+	// Pawn 주변 Chunk만 Component를 만들어서 Density를 올리고, 멀어지면 Component째 제거 (Sculpt 기록은 Manager에 남아서 다시 올릴 때 반영)
+	// Density를 요청한 Chunk 수를 반환
+	int32 UpdateServerChunkResidency();
+	// Render-Free Chunk는 항상 LOD 1
+	FChunkSettingInfo MakeResidentChunkInfo(const FIntVector& ChunkIndex) const;
+	TSet<FIntVector> PendingDensityLoads;
+	bool bRenderFree = false;
+	bool bForceRenderFree = false;
+
+	// Dedicated Server에서는 Render Mesh / Normal / Cluster / Shell / LOD 갱신을 모두 생략
+	UPROPERTY(EditAnywhere, Category="Voxel|Server", meta=(AllowPrivateAccess=true))
+	bool bRenderFreeOnDedicatedServer = true;
+	// Render-Free 모드에서 Pawn으로부터 이 거리 안의 Chunk만 Density 유지, CollisionRadius보다 작으면 CollisionRadius 사용
+	UPROPERTY(EditAnywhere, Category="Voxel|Server", meta=(ClampMin="0.0", UIMin="0.0", AllowPrivateAccess=true))
+	float ServerDensityRadius = 6000.0f;
+
+	// Pawn으로부터 이 거리 안에 있는 Chunk만 충돌 생성
+	UPROPERTY(EditAnywhere, Category="Voxel|Collision", meta=(ClampMin="0.0", UIMin="0.0", AllowPrivateAccess=true))
+	float CollisionRadius = 3000.0f;
+	// Render LOD보다 이 LOD가 거칠면 Collision은 이 LOD로 생성
+	UPROPERTY(EditAnywhere, Category="Voxel|Collision", meta=(ClampMin="1", UIMin="1", AllowPrivateAccess=true))
+	int32 CollisionLODLevel = 1;
+	UPROPERTY(EditAnywhere, Category="Voxel|Collision", meta=(ClampMin="0", UIMin="0", AllowPrivateAccess=true))
+	int32 MaxCollisionCooksPerFrame = 4;
+	// 마지막 편집 후 이 시간 동안 추가 편집이 없을 때 Cooking (연속 Dig 중 중복 Cooking 방지)
+	UPROPERTY(EditAnywhere, Category="Voxel|Collision", meta=(ClampMin="0.0", UIMin="0.0", AllowPrivateAccess=true))
+	float CollisionCoalesceDelay = 0.15f;
+	// 편집이 계속되더라도 처음 Dirty 이후 이 시간이 지나면 Cooking
+	UPROPERTY(EditAnywhere, Category="Voxel|Collision", meta=(ClampMin="0.0", UIMin="0.0", AllowPrivateAccess=true))
+	float CollisionMaxLatency = 0.5f;
+
+private:
+	/* Dig Recording / Replay */
+	void TickDigRecording(float DeltaTime);
+	void TickDigReplay(float DeltaTime);
+	void FinishDigReplay();
+
+	TUniquePtr<FVoxelDigRecording> DigRecording;
+	float DigRecordingTime = 0.0f;
+	float TimeSinceLastPathSample = 0.0f;
+
+	struct FDigReplayState
+	{
+		TSharedPtr<const FVoxelDigRecording> Recording;
+		int32 NextEvent = 0;
+		float Time = 0.0f;
+		double LastFrameTime = 0.0;
+		TArray<float> FrameMs;
+		int32 SculptCount = 0;
+		TOptional<FVector> PreviousReferenceOverride;
+	};
+	TUniquePtr<FDigReplayState> DigReplay;
+	FVoxelDigReplayStats LastDigReplayStats;
+
+	// 기록 중 기준 위치를 저장하는 간격
+	UPROPERTY(EditAnywhere, Category="Voxel|Recording", meta=(ClampMin="0.0", UIMin="0.0", AllowPrivateAccess=true))
+	float DigPathSampleInterval = 0.1f;
 
 private:
 	/* Sculpt Settings*/
@@ -81,6 +346,24 @@ private:
 	struct FChunkSculptOverrides
 	{
 		TMap<int32, FFloat16> VertexDensities;
+		// 기록한 순서대로 누적한 Hash
+		uint32 SculptHash = 0;
 	};
 	TMap<FIntVector, FChunkSculptOverrides> SculptedDensityMap;
+
+	// Density가 아직 없는 Chunk에 닿은 Sculpt, 첫 Build 후 다시 적용 (Client가 Chunk 생성 전에 Batch를 받는 경우)
+	TMap<FIntVector, TArray<FVoxelSculptOp>> DeferredSculptOps;
+	void ReplayDeferredSculpts(UVoxelChunk* Chunk);
+	// DensityApron을 선택한 Mesher와 LOD 설정에 필요한 만큼 올린 값, 모든 FChunkSettingInfo가 사용
+	int32 GetDensityApron() const;
+	// Density가 없는 Chunk에 절차적 Density 기준으로 Brush를 적용해서 바로 기록 (Render-Free Server)
+	void RecordProceduralSculpt(const FIntVector& ChunkIndex, const FVector& LocalCenter, float Radius);
+
+	/* Network */
+	// 서버에서 적용한 뒤 Client에 보낼 연산, Tick마다 하나의 Batch로 보냄
+	TArray<FVoxelSculptOp> PendingNetSculptOps;
+	void FlushNetSculptOps();
+	// Client 요청 Brush 반경 상한
+	UPROPERTY(EditAnywhere, Category="Voxel|Net", meta=(AllowPrivateAccess=true, ClampMin="1.0"))
+	float MaxNetSculptRadius = 1000.0f;
 };
@@ -0,0 +1,420 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "VoxelChunk.h"
+#include "VoxelManager.h"
+#include "Planet/Voxel/Benchmark/VoxelBenchmarkWorld.h"
+#include "Planet/Voxel/Benchmark/VoxelTestHelper.h"
+#include "Planet/Voxel/etc/VoxelHelper.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelManagerSculptTest, "Eclipser.Voxel.Manager.Sculpt", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FVoxelManagerSculptTest::RunTest(const FString& Parameters)
+{
+	FVoxelBenchmarkWorld TestWorld;
+	UVoxelManager* Manager = TestWorld.SpawnPlanet([](UVoxelManager& InManager)
+	{
+		InManager.CellSize = VoxelTestHelper::TestCellSize;
+		InManager.CellNum = 8;
+		InManager.ChunkNum = 4;
+		InManager.SetLODDistanceLevels({});
+		InManager.SetDiskCacheEnabled(false);
+	});
+
+	int32 Frames = 0;
+	if (!AddErrorIfFalse(TestWorld.TickUntil([Manager]() { return Manager->IsInitialBuildComplete(); }, VoxelTestHelper::TimeoutSeconds, Frames),
+		TEXT("Initial build did not complete")))
+		return false;
+
+	const int32 CellNum = Manager->CellNum;
+	const int32 ChunkNum = Manager->ChunkNum;
+	const float PlanetRadius = CellNum * VoxelTestHelper::TestCellSize * ChunkNum * 0.3f;
+
+	// X = 0, Y = 0 평면은 Chunk 경계이므로 이 점은 4개 Chunk가 공유
+	const FVector SeamPoint(0.0f, 0.0f, PlanetRadius);
+	const FVector SamplePoints[] = { SeamPoint, SeamPoint + FVector(60.0f, -40.0f, -80.0f), FVector(PlanetRadius, 0.0f, 0.0f) };
+
+	TArray<FVoxelDensitySample> Before;
+	TArray<FVoxelDensitySample> After;
+	Manager->QueryDensity(MakeArrayView(SamplePoints), Before);
+
+	// 반지름 0, Voxel 밖에서의 Sculpt는 아무 것도 바꾸지 않아야 함
+	Manager->Sculpt(SeamPoint, 0.0f);
+	Manager->Sculpt(FVector(PlanetRadius * 10.0f), 200.0f);
+	Manager->QueryDensity(MakeArrayView(SamplePoints), After);
+	for (int32 i = 0; i < Before.Num(); ++i)
+	{
+		AddErrorIfFalse(Before[i].Density == After[i].Density, FString::Printf(TEXT("No-op sculpt changed density at sample %d"), i));
+	}
+
+	Manager->Sculpt(SeamPoint, 200.0f);
+	Manager->QueryDensity(MakeArrayView(SamplePoints), After);
+	AddErrorIfFalse(!After[0].IsSolid(), TEXT("Seam sculpt did not carve the impact point"));
+	AddErrorIfFalse(After[2].Density == Before[2].Density, TEXT("Seam sculpt changed a distant sample"));
+
+	for (int32 z = 0; z < ChunkNum; ++z)
+		for (int32 y = 0; y < ChunkNum; ++y)
+			for (int32 x = 0; x < ChunkNum; ++x)
+			{
+				const FIntVector ChunkIndex(x, y, z);
+				UVoxelChunk* Chunk = Manager->GetChunk(ChunkIndex);
+				if (!Chunk || !Chunk->HasDensityData())
+					continue;
+
+				// 이웃 Chunk와 공유하는 경계 꼭짓점은 Sculpt 후에도 같은 값이어야 Seam이 생기지 않음
+				for (int32 Axis = 0; Axis < 3; ++Axis)
+				{
+					FIntVector NeighborIndex = ChunkIndex;
+					NeighborIndex[Axis] += 1;
+					UVoxelChunk* Neighbor = Manager->GetChunk(NeighborIndex);
+					if (!Neighbor || !Neighbor->HasDensityData())
+						continue;
+
+					bool bMatched = true;
+					for (int32 v = 0; v <= CellNum && bMatched; ++v)
+						for (int32 u = 0; u <= CellNum && bMatched; ++u)
+						{
+							FVector Local(0.0f);
+							Local[Axis] = CellNum;
+							Local[(Axis + 1) % 3] = u;
+							Local[(Axis + 2) % 3] = v;
+							FVector NeighborLocal = Local;
+							NeighborLocal[Axis] = 0.0f;
+
+							bMatched = FMath::IsNearlyEqual(Chunk->SampleDensity(Local), Neighbor->SampleDensity(NeighborLocal), 0.01f);
+						}
+
+					AddErrorIfFalse(bMatched, FString::Printf(TEXT("Seam mismatch between %s and %s"), *ChunkIndex.ToString(), *NeighborIndex.ToString()));
+				}
+
+				// 다시 생성해도 기록된 Sculpt Override로 같은 Density가 나와야 함 (Override는 FFloat16으로 저장)
+				FChunkBuildResult Regenerated;
+				UVoxelChunk::GenerateChunkData(Chunk->GetChunkInfo(), Manager, nullptr, Regenerated);
+
+				bool bMatched = true;
+				for (int32 cz = 0; cz <= CellNum && bMatched; ++cz)
+					for (int32 cy = 0; cy <= CellNum && bMatched; ++cy)
+						for (int32 cx = 0; cx <= CellNum && bMatched; ++cx)
+						{
+							const float Resident = Chunk->SampleDensity(FVector(cx, cy, cz));
+							const float Rebuilt = Regenerated.DensityData[VoxelHelper::GetIndex(cx, cy, cz, Chunk->GetChunkInfo())].Density;
+							bMatched = FMath::IsNearlyEqual(Resident, Rebuilt, FMath::Max(0.5f, FMath::Abs(Resident) * 2e-3f));
+						}
+
+				AddErrorIfFalse(bMatched, FString::Printf(TEXT("Chunk %s regenerated density does not match sculpted density"), *ChunkIndex.ToString()));
+			}
+
+	TestWorld.TickUntil([Manager]() { return !Manager->HasPendingBuilds(); }, VoxelTestHelper::TimeoutSeconds, Frames);
+
+	return true;
+}
+
+// SIMD Batch Query가 샘플별 Scalar 계산과 같은 값을 내는지 검사
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelManagerQueryDensityTest, "Eclipser.Voxel.Manager.QueryDensity", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FVoxelManagerQueryDensityTest::RunTest(const FString& Parameters)
+{
+	FVoxelBenchmarkWorld TestWorld;
+	UVoxelManager* Manager = TestWorld.SpawnPlanet([](UVoxelManager& InManager)
+	{
+		InManager.CellSize = VoxelTestHelper::TestCellSize;
+		InManager.CellNum = 8;
+		InManager.ChunkNum = 4;
+		InManager.SetLODDistanceLevels({});
+		InManager.SetDiskCacheEnabled(false);
+	});
+
+	int32 Frames = 0;
+	if (!AddErrorIfFalse(TestWorld.TickUntil([Manager]() { return Manager->IsInitialBuildComplete(); }, VoxelTestHelper::TimeoutSeconds, Frames),
+		TEXT("Initial build did not complete")))
+		return false;
+
+	const int32 CellNum = Manager->CellNum;
+	const int32 ChunkNum = Manager->ChunkNum;
+	const int32 VoxelSize = VoxelTestHelper::TestCellSize * CellNum * ChunkNum;
+	const FVector Origin = Manager->GetComponentLocation();
+	const FVector VoxelMinCorner = Origin - FVector(VoxelSize) * 0.5f;
+
+	// Density를 버린 Chunk는 Voxel 안에서도 절차적 경로를 탐
+	const FIntVector ReleasedIndex(0, 0, 0);
+	if (UVoxelChunk* Released = Manager->GetChunk(ReleasedIndex))
+	{
+		Released->ReleaseDensityData();
+	}
+
+	// 4의 배수가 아닌 개수로 남는 Lane 처리도 검사, 일부는 Voxel 밖
+	FRandomStream Random(1234);
+	TArray<FVector> Points;
+	for (int32 i = 0; i < 1003; ++i)
+	{
+		Points.Add(Origin + FVector(Random.FRandRange(-0.6f, 0.6f), Random.FRandRange(-0.6f, 0.6f), Random.FRandRange(-0.6f, 0.6f)) * VoxelSize);
+	}
+
+	TArray<FVoxelDensitySample> Samples;
+	Manager->QueryDensity(MakeArrayView(Points), Samples);
+	if (!AddErrorIfFalse(Samples.Num() == Points.Num(), FString::Printf(TEXT("Expected %d samples, got %d"), Points.Num(), Samples.Num())))
+		return false;
+
+	const float H = VoxelTestHelper::TestCellSize * 0.5f;
+	auto Evaluate = [VoxelSize](const FVector& Position) { return UVoxelChunk::EvaluateProceduralDensity(Position, VoxelSize); };
+
+	int32 Mismatches = 0;
+	int32 ResidentCount = 0;
+	for (int32 i = 0; i < Points.Num(); ++i)
+	{
+		const FVector GridPosition = (Points[i] - VoxelMinCorner) / VoxelTestHelper::TestCellSize;
+		const FIntVector ChunkIndex(FMath::FloorToInt(GridPosition.X / CellNum), FMath::FloorToInt(GridPosition.Y / CellNum), FMath::FloorToInt(GridPosition.Z / CellNum));
+		const UVoxelChunk* Chunk = Manager->GetChunk(ChunkIndex);
+
+		FVoxelDensitySample Expected;
+		if (Chunk && Chunk->HasDensityData())
+		{
+			FReadScopeLock DensityReadLock(Chunk->GetDensityLock());
+			Chunk->SampleDensityAndGradient(GridPosition - FVector(ChunkIndex * CellNum), Expected);
+			++ResidentCount;
+		}
+		else
+		{
+			const FVector Local = Points[i] - Origin;
+			Expected.Density = Evaluate(Local);
+			Expected.Gradient = FVector(
+				Evaluate(Local + FVector(H, 0, 0)) - Evaluate(Local - FVector(H, 0, 0)),
+				Evaluate(Local + FVector(0, H, 0)) - Evaluate(Local - FVector(0, H, 0)),
+				Evaluate(Local + FVector(0, 0, H)) - Evaluate(Local - FVector(0, 0, H))) / (2.0f * H);
+		}
+
+		// SIMD 경로는 float 연산이라 큰 좌표에서 약간의 오차 허용
+		const FVoxelDensitySample& Actual = Samples[i];
+		const bool bMatched = Actual.bFromResidentChunk == Expected.bFromResidentChunk
+			&& FMath::IsNearlyEqual(Actual.Density, Expected.Density, FMath::Max(0.01f, FMath::Abs(Expected.Density) * 1e-4f))
+			&& Actual.Gradient.Equals(Expected.Gradient, 1e-2f)
+			&& (!Expected.bFromResidentChunk || Actual.MaterialId == Expected.MaterialId);
+		if (!bMatched && Mismatches++ == 0)
+		{
+			AddErrorIfFalse(false, FString::Printf(TEXT("Sample %d at %s: batch density %.4f, scalar %.4f"), i, *Points[i].ToString(), Actual.Density, Expected.Density));
+		}
+	}
+
+	AddErrorIfFalse(Mismatches == 0, FString::Printf(TEXT("%d of %d batch samples differ from scalar evaluation"), Mismatches, Points.Num()));
+	AddErrorIfFalse(ResidentCount > 0 && ResidentCount < Points.Num(), TEXT("Samples did not cover both resident and procedural paths"));
+
+	TestWorld.TickUntil([Manager]() { return !Manager->HasPendingBuilds(); }, VoxelTestHelper::TimeoutSeconds, Frames);
+
+	return true;
+}
+
+// Render-Free 모드는 기준 위치 주변 Chunk만 Component를 만들고, 올리지 않은 Chunk의 Sculpt도 기록 후 Query에 반영되어야 함
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelManagerRenderFreeTest, "Eclipser.Voxel.Manager.RenderFreeResidency", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FVoxelManagerRenderFreeTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 CellNum = 8;
+	constexpr int32 ChunkNum = 8;
+	const float ChunkSize = VoxelTestHelper::TestCellSize * CellNum;
+	const float PlanetRadius = ChunkSize * ChunkNum * 0.3f;
+	const FVector NearPoint(0.0f, 0.0f, PlanetRadius);
+	const FVector FarPoint(0.0f, 0.0f, -PlanetRadius);
+
+	FVoxelBenchmarkWorld TestWorld;
+	UVoxelManager* Manager = TestWorld.SpawnPlanet([&](UVoxelManager& InManager)
+	{
+		InManager.CellSize = VoxelTestHelper::TestCellSize;
+		InManager.CellNum = CellNum;
+		InManager.ChunkNum = ChunkNum;
+		InManager.SetLODDistanceLevels({});
+		InManager.SetDiskCacheEnabled(false);
+		InManager.SetRenderFree(true);
+		InManager.SetServerDensityRadius(400.0f);
+		InManager.SetCollisionRadius(400.0f);
+		InManager.SetReferenceLocationOverride(NearPoint);
+	});
+
+	int32 Frames = 0;
+	if (!AddErrorIfFalse(TestWorld.TickUntil([Manager]() { return Manager->IsInitialBuildComplete(); }, VoxelTestHelper::TimeoutSeconds, Frames),
+		TEXT("Render-free initial build did not complete")))
+		return false;
+
+	auto ToChunkIndex = [&](const FVector& Point)
+	{
+		const FVector Grid = (Point + FVector(ChunkSize * ChunkNum * 0.5f)) / ChunkSize;
+		return FIntVector(FMath::FloorToInt(Grid.X), FMath::FloorToInt(Grid.Y), FMath::FloorToInt(Grid.Z));
+	};
+	const FIntVector NearIndex = ToChunkIndex(NearPoint);
+	const FIntVector FarIndex = ToChunkIndex(FarPoint);
+
+	AddErrorIfFalse(Manager->GetChunkCount() > 0 && Manager->GetChunkCount() < ChunkNum * ChunkNum * ChunkNum,
+		FString::Printf(TEXT("Render-free planet created %d of %d chunk components"), Manager->GetChunkCount(), ChunkNum * ChunkNum * ChunkNum));
+	AddErrorIfFalse(Manager->GetChunk(NearIndex) && Manager->GetChunk(NearIndex)->HasDensityData(), TEXT("Chunk at the reference location is not resident"));
+	AddErrorIfFalse(!Manager->GetChunk(FarIndex), TEXT("Chunk far from the reference location has a component"));
+
+	// 올리지 않은 Chunk를 Sculpt하면 바로 기록되고, Density가 도착한 뒤 Query에 반영되어야 함
+	const FVector SamplePoints[] = { FarPoint };
+	TArray<FVoxelDensitySample> Before;
+	TArray<FVoxelDensitySample> After;
+	Manager->QueryDensity(MakeArrayView(SamplePoints), Before);
+
+	Manager->Sculpt(FarPoint, 200.0f);
+	AddErrorIfFalse(Manager->GetSculptHash(FarIndex) != 0, TEXT("Sculpt on an unloaded chunk was not recorded"));
+
+	if (!AddErrorIfFalse(TestWorld.TickUntil([Manager, FarIndex]()
+		{
+			const UVoxelChunk* Chunk = Manager->GetChunk(FarIndex);
+			return Chunk && Chunk->HasDensityData() && !Manager->HasPendingBuilds();
+		}, VoxelTestHelper::TimeoutSeconds, Frames), TEXT("Sculpted chunk was not loaded")))
+		return false;
+
+	Manager->QueryDensity(MakeArrayView(SamplePoints), After);
+	AddErrorIfFalse(After[0].bFromResidentChunk && !After[0].IsSolid() && After[0].Density < Before[0].Density,
+		FString::Printf(TEXT("Query after sculpt returned %.2f (before %.2f)"), After[0].Density, Before[0].Density));
+
+	// 기준 위치가 멀어지면 Sculpt되지 않은 Chunk는 Component째 제거, Sculpt된 Chunk는 유지
+	Manager->SetReferenceLocationOverride(FVector(PlanetRadius, 0.0f, 0.0f));
+	AddErrorIfFalse(TestWorld.TickUntil([Manager, NearIndex]() { return !Manager->GetChunk(NearIndex); }, VoxelTestHelper::TimeoutSeconds, Frames),
+		TEXT("Chunk out of range was not released"));
+	AddErrorIfFalse(Manager->GetChunk(FarIndex) && Manager->GetChunk(FarIndex)->HasDensityData(), TEXT("Sculpted chunk was released"));
+
+	TestWorld.TickUntil([Manager]() { return !Manager->HasPendingBuilds(); }, VoxelTestHelper::TimeoutSeconds, Frames);
+
+	return true;
+}
+
+// 예산 초과로 Density를 버린 Chunk도 Query / Raycast 결과가 같고, Sculpt / 충돌 범위 진입 시 다시 올라와야 함
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelManagerMemoryBudgetTest, "Eclipser.Voxel.Manager.MemoryBudget", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FVoxelManagerMemoryBudgetTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 CellNum = 16;
+	constexpr int32 ChunkNum = 4;
+	const float ChunkSize = VoxelTestHelper::TestCellSize * CellNum;
+	const int32 VoxelSize = ChunkSize * ChunkNum;
+	const float PlanetRadius = VoxelSize * 0.3f;
+
+	// 기준 위치가 Voxel 밖이면 충돌이 켜진 Chunk가 없으므로 모든 Chunk가 정리 대상
+	FVoxelBenchmarkWorld TestWorld;
+	UVoxelManager* Manager = TestWorld.SpawnPlanet([&](UVoxelManager& InManager)
+	{
+		InManager.CellSize = VoxelTestHelper::TestCellSize;
+		InManager.CellNum = CellNum;
+		InManager.ChunkNum = ChunkNum;
+		InManager.SetLODDistanceLevels({});
+		InManager.SetDiskCacheEnabled(false);
+		InManager.SetCollisionRadius(200.0f);
+		InManager.SetReferenceLocationOverride(FVector(VoxelSize * 2.0f, 0.0f, 0.0f));
+	});
+
+	int32 Frames = 0;
+	if (!AddErrorIfFalse(TestWorld.TickUntil([Manager]() { return Manager->IsInitialBuildComplete() && !Manager->HasPendingBuilds(); },
+		VoxelTestHelper::TimeoutSeconds, Frames), TEXT("Initial build did not complete")))
+		return false;
+
+	const FVector Origin = Manager->GetComponentLocation();
+	const FVector VoxelMinCorner = Origin - FVector(VoxelSize) * 0.5f;
+	if (!AddErrorIfFalse(Manager->GetMemoryBytes() > 1024 * 1024, TEXT("Test planet is smaller than the minimum budget")))
+		return false;
+
+	// 보간 오차가 없도록 각 Chunk 중앙의 격자 꼭짓점에서 비교
+	TArray<FIntVector> SampleChunks;
+	TArray<FVector> SamplePoints;
+	for (int32 z = 0; z < ChunkNum; ++z)
+		for (int32 y = 0; y < ChunkNum; ++y)
+			for (int32 x = 0; x < ChunkNum; ++x)
+			{
+				SampleChunks.Add(FIntVector(x, y, z));
+				SamplePoints.Add(VoxelMinCorner + (FVector(x, y, z) * CellNum + FVector(CellNum / 2)) * VoxelTestHelper::TestCellSize);
+			}
+
+	const FVector RayStarts[] = { Origin - FVector(VoxelSize, 0.0f, 0.0f), Origin - FVector(0.0f, 0.0f, VoxelSize), Origin + FVector(-VoxelSize, 300.0f, -VoxelSize) };
+	TArray<FVoxelDensitySample> Before;
+	Manager->QueryDensity(MakeArrayView(SamplePoints), Before);
+	TArray<FVoxelRaycastHit> HitsBefore;
+	for (const FVector& Start : RayStarts)
+	{
+		Manager->Raycast(Start, Origin, HitsBefore.AddDefaulted_GetRef());
+	}
+
+	// 남은 Render Mesh만으로도 예산을 넘으므로 경고는 한 번 나와야 함
+	AddExpectedMessage(TEXT("exceeds budget after eviction"), EAutomationExpectedMessageFlags::Contains, 0);
+	Manager->SetMemoryBudgetMB(1);
+
+	auto ToChunkIndex = [&](const FVector& Point)
+	{
+		const FVector Grid = (Point - VoxelMinCorner) / ChunkSize;
+		return FIntVector(FMath::FloorToInt(Grid.X), FMath::FloorToInt(Grid.Y), FMath::FloorToInt(Grid.Z));
+	};
+	const FVector SculptPoint = Origin + FVector(-PlanetRadius, 150.0f, 150.0f);
+	const FIntVector SculptIndex = ToChunkIndex(SculptPoint);
+	if (!AddErrorIfFalse(TestWorld.TickUntil([Manager, SculptIndex]()
+		{
+			const UVoxelChunk* Chunk = Manager->GetChunk(SculptIndex);
+			return Chunk && Chunk->IsDensityReleased();
+		}, VoxelTestHelper::TimeoutSeconds, Frames), TEXT("Far chunk density was not evicted")))
+		return false;
+
+	// Pool은 Density보다 먼저 비워져야 함
+	AddErrorIfFalse(Manager->GetResultPool().GetPooledBytes() == 0,
+		FString::Printf(TEXT("Result pool still holds %lld bytes after density eviction"), Manager->GetResultPool().GetPooledBytes()));
+
+	TArray<FVoxelDensitySample> After;
+	Manager->QueryDensity(MakeArrayView(SamplePoints), After);
+	int32 EvictedCount = 0;
+	for (int32 i = 0; i < SamplePoints.Num(); ++i)
+	{
+		const UVoxelChunk* Chunk = Manager->GetChunk(SampleChunks[i]);
+		if (!Chunk || !Chunk->IsDensityReleased())
+			continue;
+
+		++EvictedCount;
+		AddErrorIfFalse(!After[i].bFromResidentChunk && FMath::IsNearlyEqual(After[i].Density, Before[i].Density, FMath::Max(0.01f, FMath::Abs(Before[i].Density) * 1e-4f)),
+			FString::Printf(TEXT("Evicted chunk %s queried %.4f, resident %.4f"), *SampleChunks[i].ToString(), After[i].Density, Before[i].Density));
+	}
+	AddErrorIfFalse(EvictedCount > 0, TEXT("No sampled chunk was evicted"));
+
+	for (int32 i = 0; i < UE_ARRAY_COUNT(RayStarts); ++i)
+	{
+		FVoxelRaycastHit Hit;
+		Manager->Raycast(RayStarts[i], Origin, Hit);
+		AddErrorIfFalse(Hit.bBlockingHit == HitsBefore[i].bBlockingHit && FMath::IsNearlyEqual(Hit.Distance, HitsBefore[i].Distance, VoxelTestHelper::TestCellSize * 0.5f),
+			FString::Printf(TEXT("Ray %d hit at %.1f after eviction, %.1f before"), i, Hit.Distance, HitsBefore[i].Distance));
+	}
+
+	// Density를 버린 Chunk를 Sculpt하면 다시 Build하고 Sculpt가 반영되어야 함
+	FVoxelDensitySample SculptBefore;
+	{
+		TArray<FVoxelDensitySample> Samples;
+		Manager->QueryDensity(MakeArrayView(&SculptPoint, 1), Samples);
+		SculptBefore = Samples[0];
+	}
+	Manager->Sculpt(SculptPoint, 200.0f);
+	if (!AddErrorIfFalse(TestWorld.TickUntil([Manager, SculptIndex]()
+		{
+			const UVoxelChunk* Chunk = Manager->GetChunk(SculptIndex);
+			return Chunk && Chunk->HasDensityData() && !Manager->HasPendingBuilds();
+		}, VoxelTestHelper::TimeoutSeconds, Frames), TEXT("Sculpted chunk density was not reloaded")))
+		return false;
+
+	TArray<FVoxelDensitySample> SculptAfter;
+	Manager->QueryDensity(MakeArrayView(&SculptPoint, 1), SculptAfter);
+	AddErrorIfFalse(SculptAfter[0].bFromResidentChunk && !SculptAfter[0].IsSolid() && SculptAfter[0].Density < SculptBefore.Density,
+		FString::Printf(TEXT("Query after sculpt on evicted chunk returned %.2f (before %.2f)"), SculptAfter[0].Density, SculptBefore.Density));
+
+	// 기준 위치가 가까워져서 충돌이 켜지면 Density를 다시 올림
+	const FVector CollisionPoint = Origin + FVector(150.0f, 150.0f, -PlanetRadius);
+	const FIntVector CollisionIndex = ToChunkIndex(CollisionPoint);
+	const UVoxelChunk* CollisionChunk = Manager->GetChunk(CollisionIndex);
+	if (!AddErrorIfFalse(CollisionChunk && CollisionChunk->IsDensityReleased(), TEXT("Chunk under the new reference location was not evicted")))
+		return false;
+
+	Manager->SetReferenceLocationOverride(CollisionPoint);
+	AddErrorIfFalse(TestWorld.TickUntil([Manager, CollisionIndex]()
+		{
+			const UVoxelChunk* Chunk = Manager->GetChunk(CollisionIndex);
+			return Chunk && Chunk->IsCollisionActive() && Chunk->HasDensityData() && !Manager->HasPendingBuilds();
+		}, VoxelTestHelper::TimeoutSeconds, Frames), TEXT("Chunk entering collision range did not reload density"));
+
+	TestWorld.TickUntil([Manager]() { return !Manager->HasPendingBuilds(); }, VoxelTestHelper::TimeoutSeconds, Frames);
+
+	return true;
+}
+
+#endif
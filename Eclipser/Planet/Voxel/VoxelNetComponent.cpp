@@ -0,0 +1,219 @@
+#include "VoxelNetComponent.h"
+
+#include "Eclipser.h"
+#include "EclipserCharacter.h"
+#include "EngineUtils.h"
+#include "GameFramework/SpringArmComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Planet/Planet.h"
+#include "Planet/Voxel/VoxelManager.h"
+#include "Planet/Voxel/Defines/VoxelStats.h"
+#include "Planet/Voxel/etc/VoxelSculptCodec.h"
+
+UVoxelNetComponent::UVoxelNetComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	SetIsReplicatedByDefault(true);
+}
+
+void UVoxelNetComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// 서버에서 원격 Client의 Controller가 생기면 지금까지의 Sculpt 기록을 Snapshot 대기열에 넣음
+	const APlayerController* Controller = Cast<APlayerController>(GetOwner());
+	if (!Controller || !Controller->HasAuthority() || Controller->IsLocalController())
+		return;
+
+	for (TActorIterator<APlanet> It(GetWorld()); It; ++It)
+	{
+		UVoxelManager* Manager = It->VoxelManager;
+		if (!IsValid(Manager))
+			continue;
+
+		FPendingSnapshot& Snapshot = PendingSnapshots.AddDefaulted_GetRef();
+		Snapshot.Manager = Manager;
+		Manager->GetSculptedChunkIndices(Snapshot.ChunkIndices);
+	}
+
+	PendingSnapshots.RemoveAll([](const FPendingSnapshot& Snapshot) { return Snapshot.ChunkIndices.Num() == 0; });
+	SetComponentTickEnabled(PendingSnapshots.Num() > 0);
+}
+
+void UVoxelNetComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	TickSnapshot(DeltaTime);
+	if (PendingSnapshots.Num() == 0)
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UVoxelNetComponent::RequestSculpt(UVoxelManager* Manager, const FVector& ImpactPoint, float Radius)
+{
+	if (!IsValid(Manager))
+		return;
+
+	if (GetNetMode() == NM_Client)
+	{
+		ServerSculpt(Manager, ImpactPoint, Radius);
+		return;
+	}
+	Manager->Sculpt(ImpactPoint, Radius);
+}
+
+void UVoxelNetComponent::SendSculptBatch(UVoxelManager* Manager, const TArray<uint8>& Batch)
+{
+	INC_DWORD_STAT_BY(STAT_VoxelNetSculptBytes, Batch.Num());
+	ClientSculptBatch(Manager, Batch);
+}
+
+bool UVoxelNetComponent::ServerSculpt_Validate(UVoxelManager* Manager, FVector_NetQuantize ImpactPoint, float Radius)
+{
+	// 정상 Client도 보낼 수 있는 범위 밖 요청은 Implementation에서 버리고, 여기서는 깨진 값만 걸러냄
+	return FMath::IsFinite(Radius) && !ImpactPoint.ContainsNaN();
+}
+
+void UVoxelNetComponent::ServerSculpt_Implementation(UVoxelManager* Manager, FVector_NetQuantize ImpactPoint, float Radius)
+{
+	// 너무 큰 Brush는 서버 설정값으로 줄여서 적용
+	if (IsValid(Manager) && Radius > 0.0f)
+	{
+		Radius = FMath::Min(Radius, Manager->GetMaxNetSculptRadius());
+		if (CanAcceptSculpt(Manager, ImpactPoint, Radius))
+		{
+			Manager->Sculpt(ImpactPoint, Radius);
+		}
+	}
+}
+
+bool UVoxelNetComponent::CanAcceptSculpt(const UVoxelManager* Manager, const FVector& ImpactPoint, float Radius)
+{
+	if (Manager->GetWorld() != GetWorld())
+		return false;
+
+	// 최대 1초 분량까지 모아둔 요청 허용량에서 하나씩 사용
+	const double Now = GetWorld()->GetTimeSeconds();
+	SculptAllowance = FMath::Min(SculptAllowance + static_cast<float>(Now - LastSculptAllowanceTime) * MaxSculptsPerSecond, MaxSculptsPerSecond);
+	LastSculptAllowanceTime = Now;
+	if (SculptAllowance < 1.0f)
+	{
+		UE_LOG(LogEclipser, Verbose, TEXT("Dropped sculpt from %s: rate limit"), *GetNameSafe(GetOwner()));
+		return false;
+	}
+
+	// Client의 Ray는 Camera에서 시작하므로 Pawn 기준으로는 Camera Boom 길이만큼 더 멀 수 있음
+	const APlayerController* Controller = Cast<APlayerController>(GetOwner());
+	const AEclipserCharacter* Character = Controller ? Cast<AEclipserCharacter>(Controller->GetPawn()) : nullptr;
+	if (!Character)
+		return false;
+
+	const float ArmLength = Character->GetCameraBoom() ? Character->GetCameraBoom()->TargetArmLength : 0.0f;
+	const float MaxDistance = Character->GetMaxDigDistance() + ArmLength + Radius + SculptDistanceTolerance;
+	if (FVector::DistSquared(Character->GetActorLocation(), ImpactPoint) > FMath::Square(MaxDistance))
+	{
+		UE_LOG(LogEclipser, Verbose, TEXT("Dropped sculpt from %s: out of reach"), *GetNameSafe(GetOwner()));
+		return false;
+	}
+
+	SculptAllowance -= 1.0f;
+	return true;
+}
+
+void UVoxelNetComponent::ClientSculptBatch_Implementation(UVoxelManager* Manager, const TArray<uint8>& Batch)
+{
+	if (IsValid(Manager))
+	{
+		Manager->ApplyNetSculptBatch(Batch);
+	}
+}
+
+void UVoxelNetComponent::ClientSculptSnapshot_Implementation(UVoxelManager* Manager, FIntVector ChunkIndex, const TArray<uint8>& Overrides)
+{
+	TArray<TPair<int32, FFloat16>> Decoded;
+	if (IsValid(Manager) && VoxelSculptCodec::DecodeChunkOverrides(Overrides, Decoded))
+	{
+		Manager->ApplyNetSculptSnapshot(ChunkIndex, Decoded);
+	}
+}
+
+void UVoxelNetComponent::TickSnapshot(float DeltaTime)
+{
+	// 쓰지 않은 전송량은 최대 1초 분량까지만 모아둠
+	SnapshotByteAllowance = FMath::Min(SnapshotByteAllowance + SnapshotBytesPerSecond * DeltaTime, static_cast<float>(SnapshotBytesPerSecond));
+
+	const FVector ViewLocation = GetViewLocation();
+	TArray<uint8> Bytes;
+
+	// RPC 하나를 보낼 때마다 전송량을 확인, 큰 Chunk는 남은 조각을 다음 Tick에 이어서 보냄
+	while (SnapshotByteAllowance > 0.0f && PendingSnapshots.Num() > 0)
+	{
+		FPendingSnapshot& Snapshot = PendingSnapshots.Last();
+		UVoxelManager* Manager = Snapshot.Manager.Get();
+		if (!Manager)
+		{
+			PendingSnapshots.Pop();
+			continue;
+		}
+
+		if (Snapshot.ResumeOffset < Snapshot.CurrentOverrides.Num())
+		{
+			const int32 Count = FMath::Min(SnapshotOverridesPerRPC, Snapshot.CurrentOverrides.Num() - Snapshot.ResumeOffset);
+			VoxelSculptCodec::EncodeChunkOverrides(MakeArrayView(Snapshot.CurrentOverrides.GetData() + Snapshot.ResumeOffset, Count), Bytes);
+			Snapshot.ResumeOffset += Count;
+			if (Bytes.Num() == 0)
+				continue;
+
+			ClientSculptSnapshot(Manager, Snapshot.CurrentChunkIndex, Bytes);
+			SnapshotByteAllowance -= Bytes.Num();
+			INC_DWORD_STAT_BY(STAT_VoxelNetSnapshotBytes, Bytes.Num());
+			continue;
+		}
+
+		if (Snapshot.ChunkIndices.Num() == 0)
+		{
+			PendingSnapshots.Pop();
+			continue;
+		}
+
+		// 이동 중에도 현재 위치에서 가장 가까운 Chunk부터 보냄
+		int32 NearestIndex = 0;
+		double NearestDistance = TNumericLimits<double>::Max();
+		for (int32 i = 0; i < Snapshot.ChunkIndices.Num(); ++i)
+		{
+			const double Distance = FVector::DistSquared(ViewLocation, Manager->GetChunkWorldLocation(Snapshot.ChunkIndices[i]));
+			if (Distance < NearestDistance)
+			{
+				NearestDistance = Distance;
+				NearestIndex = i;
+			}
+		}
+		const FIntVector ChunkIndex = Snapshot.ChunkIndices[NearestIndex];
+		Snapshot.ChunkIndices.RemoveAtSwap(NearestIndex);
+
+		// 보내기 시작하는 시점의 최신 기록을 사용, 그 사이 Sculpt는 Batch로도 오지만 Dig는 최소값 병합이라 순서와 관계없이 같은 결과
+		Manager->GetSortedSculptOverrides(ChunkIndex, Snapshot.CurrentOverrides);
+		Snapshot.CurrentChunkIndex = ChunkIndex;
+		Snapshot.ResumeOffset = 0;
+	}
+}
+
+FVector UVoxelNetComponent::GetViewLocation() const
+{
+	const APlayerController* Controller = Cast<APlayerController>(GetOwner());
+	if (!Controller)
+		return FVector::ZeroVector;
+
+	if (const APawn* Pawn = Controller->GetPawn())
+	{
+		return Pawn->GetActorLocation();
+	}
+
+	FVector Location;
+	FRotator Rotation;
+	Controller->GetPlayerViewPoint(Location, Rotation);
+	return Location;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Engine/NetSerialization.h"
+#include "Math/Float16.h"
+#include "VoxelNetComponent.generated.h"
+
+class UVoxelManager;
+
+/*
+ * PlayerController에 붙여서 Sculpt를 서버 권한으로 동기화하는 Component
+ * Client의 Sculpt 요청은 Server RPC로 보내고, 서버가 양자화해서 적용한 연산은 Manager가 Tick마다 모아서 각 Client에 한 번에 전달
+ * 늦게 들어온 Client에게는 Sculpt된 Chunk의 기록만 압축해서 가까운 Chunk부터 초당 전송량 안에서 나눠 보냄
+ * 전송량은 Planet 크기가 아니라 Sculpt 양에 비례
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class ECLIPSER_API UVoxelNetComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UVoxelNetComponent();
+
+	// Client면 서버로 요청, 서버 / Standalone이면 바로 적용
+	void RequestSculpt(UVoxelManager* Manager, const FVector& ImpactPoint, float Radius);
+	// 서버에서 호출, Manager가 모은 연산 Batch를 이 Client에 전달
+	void SendSculptBatch(UVoxelManager* Manager, const TArray<uint8>& Batch);
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	UFUNCTION(Server, Reliable, WithValidation)
+	void ServerSculpt(UVoxelManager* Manager, FVector_NetQuantize ImpactPoint, float Radius);
+
+	UFUNCTION(Client, Reliable)
+	void ClientSculptBatch(UVoxelManager* Manager, const TArray<uint8>& Batch);
+
+	UFUNCTION(Client, Reliable)
+	void ClientSculptSnapshot(UVoxelManager* Manager, FIntVector ChunkIndex, const TArray<uint8>& Overrides);
+
+private:
+	// 늦게 들어온 Client에게 보내는 Snapshot 전송량 (Byte / 초)
+	UPROPERTY(EditAnywhere, Category="Voxel|Net", meta=(AllowPrivateAccess=true, ClampMin="1024"))
+	int32 SnapshotBytesPerSecond = 64 * 1024;
+	// RPC 하나에 담는 최대 꼭짓점 수, Sculpt가 많은 Chunk는 여러 번 나눠 보냄
+	UPROPERTY(EditAnywhere, Category="Voxel|Net", meta=(AllowPrivateAccess=true, ClampMin="256"))
+	int32 SnapshotOverridesPerRPC = 8192;
+	// Client 하나가 초당 요청할 수 있는 Sculpt 수, 남은 요청은 버림
+	UPROPERTY(EditAnywhere, Category="Voxel|Net", meta=(AllowPrivateAccess=true, ClampMin="1"))
+	float MaxSculptsPerSecond = 10.0f;
+	// 위치 양자화와 이동 지연을 감안한 거리 여유분
+	UPROPERTY(EditAnywhere, Category="Voxel|Net", meta=(AllowPrivateAccess=true, ClampMin="0"))
+	float SculptDistanceTolerance = 100.0f;
+
+	float SculptAllowance = 0.0f;
+	double LastSculptAllowanceTime = 0.0;
+
+	// 서버에서 받은 요청이 이 Client의 Pawn이 닿을 수 있는 범위 / 빈도인지 검사
+	bool CanAcceptSculpt(const UVoxelManager* Manager, const FVector& ImpactPoint, float Radius);
+
+	struct FPendingSnapshot
+	{
+		TWeakObjectPtr<UVoxelManager> Manager;
+		TArray<FIntVector> ChunkIndices;
+		// 여러 RPC / Tick에 나눠 보내는 중인 Chunk, ResumeOffset번째 기록부터 이어서 보냄
+		FIntVector CurrentChunkIndex = FIntVector::ZeroValue;
+		TArray<TPair<int32, FFloat16>> CurrentOverrides;
+		int32 ResumeOffset = 0;
+	};
+	TArray<FPendingSnapshot> PendingSnapshots;
+	float SnapshotByteAllowance = 0.0f;
+
+	void TickSnapshot(float DeltaTime);
+	// Snapshot 우선순위 기준, Pawn이 아직 없으면 Controller의 시점 위치
+	FVector GetViewLocation() const;
+};
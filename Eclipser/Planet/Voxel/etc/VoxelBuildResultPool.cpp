@@ -0,0 +1,81 @@
+#include "VoxelBuildResultPool.h"
+
+FVoxelBuildResultPool::~FVoxelBuildResultPool()
+{
+	while (FPendingChunkResult* Pending = FreeList.Pop())
+	{
+		delete Pending;
+	}
+}
+
+TUniquePtr<FPendingChunkResult> FVoxelBuildResultPool::Acquire()
+{
+	if (FPendingChunkResult* Pending = FreeList.Pop())
+	{
+		PooledCount.fetch_sub(1, std::memory_order_relaxed);
+		PooledBytes.fetch_sub(GetAllocatedBytes(Pending->Result), std::memory_order_relaxed);
+		ReusedCount.fetch_add(1, std::memory_order_relaxed);
+		return TUniquePtr<FPendingChunkResult>(Pending);
+	}
+	AllocatedCount.fetch_add(1, std::memory_order_relaxed);
+	return MakeUnique<FPendingChunkResult>();
+}
+
+void FVoxelBuildResultPool::Release(TUniquePtr<FPendingChunkResult>&& Pending)
+{
+	if (!Pending.IsValid())
+		return;
+
+	// Pool이 가득 차면 그냥 해제
+	if (PooledCount.fetch_add(1, std::memory_order_relaxed) >= MaxPooledCount)
+	{
+		PooledCount.fetch_sub(1, std::memory_order_relaxed);
+		Pending.Reset();
+		return;
+	}
+
+	// 보관 용량 한도를 넘는 버퍼도 해제 (큰 Chunk 버퍼가 계속 남지 않도록)
+	const int64 Bytes = GetAllocatedBytes(Pending->Result);
+	if (PooledBytes.fetch_add(Bytes, std::memory_order_relaxed) + Bytes > MaxPooledBytes)
+	{
+		PooledBytes.fetch_sub(Bytes, std::memory_order_relaxed);
+		PooledCount.fetch_sub(1, std::memory_order_relaxed);
+		Pending.Reset();
+		return;
+	}
+
+	// 할당된 용량은 유지한 채 내용만 비움
+	Pending->Chunk.Reset();
+	Pending->Result.MeshData.Vertices.Reset();
+	Pending->Result.MeshData.Normals.Reset();
+	Pending->Result.MeshData.Colors.Reset();
+	Pending->Result.MeshData.Triangles.Reset();
+	Pending->Result.DensityData.Reset();
+
+	FreeList.Push(Pending.Release());
+}
+
+int64 FVoxelBuildResultPool::Trim(int64 TargetBytes)
+{
+	int64 FreedBytes = 0;
+	while (PooledBytes.load(std::memory_order_relaxed) > TargetBytes)
+	{
+		FPendingChunkResult* Pending = FreeList.Pop();
+		if (!Pending)
+			break;
+
+		const int64 Bytes = GetAllocatedBytes(Pending->Result);
+		PooledCount.fetch_sub(1, std::memory_order_relaxed);
+		PooledBytes.fetch_sub(Bytes, std::memory_order_relaxed);
+		FreedBytes += Bytes;
+		delete Pending;
+	}
+	return FreedBytes;
+}
+
+int64 FVoxelBuildResultPool::GetAllocatedBytes(const FChunkBuildResult& Result)
+{
+	return Result.DensityData.GetAllocatedSize() + Result.BrickMinMax.Min.GetAllocatedSize() + Result.BrickMinMax.Max.GetAllocatedSize()
+		+ Result.MeshData.Vertices.GetAllocatedSize() + Result.MeshData.Normals.GetAllocatedSize()
+		+ Result.MeshData.Colors.GetAllocatedSize() + Result.MeshData.Triangles.GetAllocatedSize();
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LockFreeList.h"
+#include "Planet/Voxel/Defines/VoxelStructs.h"
+
+/*
+ * Worker -> Game Thread로 넘기는 Chunk 생성 결과 버퍼 Pool
+ * 결과는 TUniquePtr로 소유권만 이동하고, Chunk가 소비한 뒤(이전 데이터와 Swap) 용량을 유지한 채 반환되어 다음 생성에 재사용됨
+ * 보관하는 버퍼는 개수와 할당 용량 합계로 제한, Chunk / Apron이 커도 보관량이 MaxPooledBytes를 넘지 않음
+ */
+class FVoxelBuildResultPool
+{
+public:
+	explicit FVoxelBuildResultPool(int32 InMaxPooledCount = 64, int64 InMaxPooledBytes = 64ll * 1024 * 1024)
+		: MaxPooledCount(InMaxPooledCount), MaxPooledBytes(InMaxPooledBytes) {}
+	~FVoxelBuildResultPool();
+
+	TUniquePtr<FPendingChunkResult> Acquire();
+	void Release(TUniquePtr<FPendingChunkResult>&& Pending);
+
+	// 보관 중인 버퍼를 TargetBytes 이하가 될 때까지 해제, 해제한 크기를 반환 (메모리 예산이 먼저 호출)
+	int64 Trim(int64 TargetBytes = 0);
+	int64 GetPooledBytes() const { return PooledBytes.load(std::memory_order_relaxed); }
+	static int64 GetAllocatedBytes(const FChunkBuildResult& Result);
+
+	// Benchmark용 : 새로 할당한 버퍼 수 / Pool에서 재사용한 버퍼 수
+	int64 GetAllocatedCount() const { return AllocatedCount.load(std::memory_order_relaxed); }
+	int64 GetReusedCount() const { return ReusedCount.load(std::memory_order_relaxed); }
+	void ResetCounters() { AllocatedCount.store(0); ReusedCount.store(0); }
+
+private:
+	TLockFreePointerListUnordered<FPendingChunkResult, PLATFORM_CACHE_LINE_SIZE> FreeList;
+	std::atomic<int32> PooledCount{0};
+	std::atomic<int64> PooledBytes{0};
+	std::atomic<int64> AllocatedCount{0};
+	std::atomic<int64> ReusedCount{0};
+	const int32 MaxPooledCount;
+	const int64 MaxPooledBytes;
+};
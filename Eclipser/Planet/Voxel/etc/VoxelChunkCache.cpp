@@ -0,0 +1,272 @@
+#include "VoxelChunkCache.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Planet/Voxel/VoxelChunk.h"
+#include "Planet/Voxel/Defines/VoxelStats.h"
+#include "Planet/Voxel/etc/VoxelHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	constexpr uint32 ChunkCacheMagic = 0x43435856; // "VXCC"
+	constexpr uint32 ChunkCacheVersion = 2;
+
+	struct FChunkCacheHeader
+	{
+		uint32 Magic = ChunkCacheMagic;
+		uint32 Version = ChunkCacheVersion;
+		uint32 SettingsHash = 0;
+		uint32 SculptHash = 0;
+		int32 UncompressedSize = 0;
+
+		friend FArchive& operator<<(FArchive& Ar, FChunkCacheHeader& Header)
+		{
+			return Ar << Header.Magic << Header.Version << Header.SettingsHash << Header.SculptHash << Header.UncompressedSize;
+		}
+	};
+}
+
+FVoxelChunkCache::FVoxelChunkCache(const FString& InDirectory, int64 InMaxBytes)
+	: Directory(InDirectory), MaxBytes(InMaxBytes)
+{
+	IFileManager::Get().MakeDirectory(*Directory, true);
+
+	// 이전 실행에서 남은 파일 크기를 계산하면서 한도를 넘은 만큼 정리
+	Trim(MaxBytes > 0 ? MaxBytes : TNumericLimits<int64>::Max());
+}
+
+bool FVoxelChunkCache::LoadDensity(const FChunkSettingInfo& Info, uint32 SculptHash, FChunkBuildResult& OutResult) const
+{
+	VOXEL_SCOPE_STAGE(CacheLoad);
+
+	TArray<uint8> Payload;
+	if (!LoadPayload(GetDensityPath(Info), MakeDensitySettingsHash(Info), SculptHash, Payload))
+	{
+		INC_DWORD_STAT(STAT_VoxelCacheMisses);
+		return false;
+	}
+
+	FMemoryReader Reader(Payload);
+	int32 DensityNum = 0;
+	Reader << DensityNum;
+	if (Reader.IsError() || DensityNum != VoxelHelper::GetDensityDataNum(Info))
+	{
+		INC_DWORD_STAT(STAT_VoxelCacheMisses);
+		return false;
+	}
+
+	OutResult.DensityData.SetNumUninitialized(DensityNum, EAllowShrinking::No);
+	Reader.Serialize(OutResult.DensityData.GetData(), DensityNum * sizeof(FVertexDensity));
+	if (Reader.IsError())
+	{
+		INC_DWORD_STAT(STAT_VoxelCacheMisses);
+		return false;
+	}
+
+	// Brick 최소/최대값은 저장하지 않고 다시 계산 (Density 한 번 훑는 비용)
+	VoxelHelper::BuildBrickMinMax(Info, OutResult.DensityData, OutResult.BrickMinMax);
+	INC_DWORD_STAT(STAT_VoxelCacheHits);
+	return true;
+}
+
+bool FVoxelChunkCache::LoadMesh(const FChunkSettingInfo& Info, uint32 SculptHash, FVoxelData& OutMeshData) const
+{
+	VOXEL_SCOPE_STAGE(CacheLoad);
+
+	TArray<uint8> Payload;
+	if (!LoadPayload(GetMeshPath(Info), MakeMeshSettingsHash(Info), SculptHash, Payload))
+	{
+		INC_DWORD_STAT(STAT_VoxelCacheMisses);
+		return false;
+	}
+
+	FMemoryReader Reader(Payload);
+	Reader << OutMeshData.Vertices << OutMeshData.Normals << OutMeshData.Colors << OutMeshData.Triangles;
+	if (Reader.IsError())
+	{
+		INC_DWORD_STAT(STAT_VoxelCacheMisses);
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_VoxelCacheHits);
+	return true;
+}
+
+TArray<uint8> FVoxelChunkCache::SerializeDensity(const FChunkSettingInfo& Info, uint32 SculptHash, const TArray<FVertexDensity>& DensityData)
+{
+	TArray<uint8> Payload;
+	FMemoryWriter Writer(Payload);
+
+	FChunkCacheHeader Header;
+	Header.SettingsHash = MakeDensitySettingsHash(Info);
+	Header.SculptHash = SculptHash;
+	Writer << Header;
+
+	int32 DensityNum = DensityData.Num();
+	Writer << DensityNum;
+	Writer.Serialize(const_cast<FVertexDensity*>(DensityData.GetData()), DensityNum * sizeof(FVertexDensity));
+	return Payload;
+}
+
+TArray<uint8> FVoxelChunkCache::SerializeMesh(const FChunkSettingInfo& Info, uint32 SculptHash, const FVoxelData& MeshData)
+{
+	TArray<uint8> Payload;
+	FMemoryWriter Writer(Payload);
+
+	FChunkCacheHeader Header;
+	Header.SettingsHash = MakeMeshSettingsHash(Info);
+	Header.SculptHash = SculptHash;
+	Writer << Header;
+
+	FVoxelData& Mesh = const_cast<FVoxelData&>(MeshData);
+	Writer << Mesh.Vertices << Mesh.Normals << Mesh.Colors << Mesh.Triangles;
+	return Payload;
+}
+
+void FVoxelChunkCache::WriteDensity(const FChunkSettingInfo& Info, const TArray<uint8>& Entry) const
+{
+	WriteFile(GetDensityPath(Info), Entry);
+}
+
+void FVoxelChunkCache::WriteMesh(const FChunkSettingInfo& Info, const TArray<uint8>& Entry) const
+{
+	WriteFile(GetMeshPath(Info), Entry);
+}
+
+void FVoxelChunkCache::Trim(int64 TargetBytes) const
+{
+	struct FCacheFile
+	{
+		FString Path;
+		FDateTime Time;
+		int64 Size;
+	};
+
+	TArray<FCacheFile> Files;
+	int64 TotalBytes = 0;
+	FPlatformFileManager::Get().GetPlatformFile().IterateDirectoryStat(*Directory, [&Files, &TotalBytes](const TCHAR* Path, const FFileStatData& StatData)
+	{
+		if (!StatData.bIsDirectory)
+		{
+			Files.Add({ Path, StatData.ModificationTime, StatData.FileSize });
+			TotalBytes += StatData.FileSize;
+		}
+		return true;
+	});
+
+	if (TotalBytes > TargetBytes)
+	{
+		Files.Sort([](const FCacheFile& A, const FCacheFile& B) { return A.Time < B.Time; });
+		for (const FCacheFile& File : Files)
+		{
+			if (TotalBytes <= TargetBytes)
+				break;
+			if (IFileManager::Get().Delete(*File.Path, false, false, true))
+			{
+				TotalBytes -= File.Size;
+			}
+		}
+	}
+	DirectoryBytes.store(TotalBytes, std::memory_order_relaxed);
+}
+
+bool FVoxelChunkCache::LoadPayload(const FString& Path, uint32 SettingsHash, uint32 SculptHash, TArray<uint8>& OutPayload) const
+{
+	TArray<uint8> FileBytes;
+	if (!FFileHelper::LoadFileToArray(FileBytes, *Path, FILEREAD_Silent))
+		return false;
+
+	FMemoryReader FileReader(FileBytes);
+	FChunkCacheHeader Header;
+	FileReader << Header;
+	if (FileReader.IsError() || Header.Magic != ChunkCacheMagic || Header.Version != ChunkCacheVersion
+		|| Header.SettingsHash != SettingsHash || Header.SculptHash != SculptHash || Header.UncompressedSize <= 0)
+		return false;
+
+	OutPayload.SetNumUninitialized(Header.UncompressedSize);
+	const int64 CompressedOffset = FileReader.Tell();
+	if (!FCompression::UncompressMemory(NAME_Oodle, OutPayload.GetData(), OutPayload.Num(),
+		FileBytes.GetData() + CompressedOffset, FileBytes.Num() - CompressedOffset))
+		return false;
+
+	// 사용한 파일은 시간을 갱신해서 정리 순서에서 뒤로 보냄
+	IFileManager::Get().SetTimeStamp(*Path, FDateTime::UtcNow());
+	return true;
+}
+
+void FVoxelChunkCache::WriteFile(const FString& Path, const TArray<uint8>& Entry) const
+{
+	VOXEL_SCOPE_STAGE(CacheSave);
+
+	// Entry = 압축하지 않은 Header + Payload, Header는 그대로 두고 Payload만 압축
+	FChunkCacheHeader Header;
+	FMemoryReader HeaderReader(Entry);
+	HeaderReader << Header;
+	const int64 PayloadOffset = HeaderReader.Tell();
+	const int32 PayloadSize = Entry.Num() - PayloadOffset;
+	Header.UncompressedSize = PayloadSize;
+
+	TArray<uint8> FileBytes;
+	FMemoryWriter Writer(FileBytes);
+	Writer << Header;
+	const int64 CompressedOffset = FileBytes.Num();
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, PayloadSize);
+	FileBytes.SetNumUninitialized(CompressedOffset + CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Oodle, FileBytes.GetData() + CompressedOffset, CompressedSize, Entry.GetData() + PayloadOffset, PayloadSize))
+		return;
+	FileBytes.SetNum(CompressedOffset + CompressedSize);
+
+	const FString TempPath = FString::Printf(TEXT("%s.%s.tmp"), *Path, *FGuid::NewGuid().ToString());
+	if (!FFileHelper::SaveArrayToFile(FileBytes, *TempPath) || !IFileManager::Get().Move(*Path, *TempPath, true, true))
+		return;
+
+	// 덮어쓴 파일도 더하므로 실제보다 크게 잡힐 수 있음, 정리할 때 폴더를 다시 훑어서 보정
+	// 한도를 넘으면 다음 쓰기까지 여유를 두도록 3/4까지 줄임, 한 Worker만 정리
+	if (DirectoryBytes.fetch_add(FileBytes.Num(), std::memory_order_relaxed) + FileBytes.Num() > MaxBytes && MaxBytes > 0
+		&& !bTrimming.exchange(true))
+	{
+		Trim(MaxBytes / 4 * 3);
+		bTrimming.store(false);
+	}
+}
+
+FString FVoxelChunkCache::MakeDefaultDirectory(const FString& Name)
+{
+	return FPaths::ProjectSavedDir() / TEXT("VoxelCache") / FPaths::MakeValidFileName(Name);
+}
+
+FString FVoxelChunkCache::GetDensityPath(const FChunkSettingInfo& Info) const
+{
+	return Directory / FString::Printf(TEXT("%d_%d_%d.vxd"), Info.ChunkIndex.X, Info.ChunkIndex.Y, Info.ChunkIndex.Z);
+}
+
+FString FVoxelChunkCache::GetMeshPath(const FChunkSettingInfo& Info) const
+{
+	return Directory / FString::Printf(TEXT("%d_%d_%d_L%d.vxc"), Info.ChunkIndex.X, Info.ChunkIndex.Y, Info.ChunkIndex.Z, Info.LODLevel);
+}
+
+uint32 FVoxelChunkCache::MakeDensitySettingsHash(const FChunkSettingInfo& Info)
+{
+	uint32 Hash = GetTypeHash(UVoxelChunk::ProceduralDensityVersion);
+	Hash = HashCombine(Hash, GetTypeHash(Info.CellSize));
+	Hash = HashCombine(Hash, GetTypeHash(Info.CellNum));
+	Hash = HashCombine(Hash, GetTypeHash(Info.ChunkNum));
+	Hash = HashCombine(Hash, GetTypeHash(Info.Apron));
+	Hash = HashCombine(Hash, GetTypeHash(Info.DensityLayout));
+	return Hash;
+}
+
+uint32 FVoxelChunkCache::MakeMeshSettingsHash(const FChunkSettingInfo& Info)
+{
+	uint32 Hash = MakeDensitySettingsHash(Info);
+	Hash = HashCombine(Hash, GetTypeHash(Info.MesherType));
+	Hash = HashCombine(Hash, GetTypeHash(Info.TriangleBudget));
+	Hash = HashCombine(Hash, GetTypeHash(Info.LODLevel));
+	return Hash;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Planet/Voxel/Defines/VoxelStructs.h"
+
+/*
+ * Chunk별 Density와 Chunk / LOD별 Mesh를 압축해서 디스크에 저장하는 Cache
+ * Density는 LOD와 무관하므로 Chunk당 파일 하나(.vxd), Mesh는 LOD마다 파일 하나(.vxc)
+ * Header의 생성 설정 Hash와 Sculpt Hash가 같을 때만 사용
+ * 폴더 전체 크기가 MaxBytes를 넘으면 가장 오래 사용하지 않은 파일부터 삭제 (읽을 때마다 파일 시간을 갱신)
+ * 모든 Load / Write는 Build Task(Worker Thread)에서 호출, 같은 파일을 동시에 쓰더라도 임시 파일 후 Move로 교체
+ */
+class FVoxelChunkCache
+{
+public:
+	FVoxelChunkCache(const FString& InDirectory, int64 InMaxBytes);
+
+	// 없거나 Key가 다르거나 손상된 파일이면 false, 출력은 덮어쓴 상태일 수 있음
+	// Density를 읽으면 Brick 최소/최대값도 다시 계산
+	bool LoadDensity(const FChunkSettingInfo& Info, uint32 SculptHash, FChunkBuildResult& OutResult) const;
+	bool LoadMesh(const FChunkSettingInfo& Info, uint32 SculptHash, FVoxelData& OutMeshData) const;
+
+	// 결과를 Game Thread로 넘기기 전에 메모리로 직렬화만 해두고, 압축 / 쓰기는 넘긴 뒤에 처리
+	static TArray<uint8> SerializeDensity(const FChunkSettingInfo& Info, uint32 SculptHash, const TArray<FVertexDensity>& DensityData);
+	static TArray<uint8> SerializeMesh(const FChunkSettingInfo& Info, uint32 SculptHash, const FVoxelData& MeshData);
+	void WriteDensity(const FChunkSettingInfo& Info, const TArray<uint8>& Entry) const;
+	void WriteMesh(const FChunkSettingInfo& Info, const TArray<uint8>& Entry) const;
+
+	// 폴더 크기를 TargetBytes 이하로 줄임, 오래 사용하지 않은 파일부터 삭제
+	void Trim(int64 TargetBytes) const;
+	int64 GetDirectoryBytes() const { return DirectoryBytes.load(std::memory_order_relaxed); }
+
+	static FString MakeDefaultDirectory(const FString& Name);
+
+private:
+	FString GetDensityPath(const FChunkSettingInfo& Info) const;
+	FString GetMeshPath(const FChunkSettingInfo& Info) const;
+	// 파일을 읽어서 Header를 검사하고 압축을 푼 Payload를 반환
+	bool LoadPayload(const FString& Path, uint32 SettingsHash, uint32 SculptHash, TArray<uint8>& OutPayload) const;
+	void WriteFile(const FString& Path, const TArray<uint8>& Entry) const;
+
+	// Density 결과에 영향을 주는 설정 Hash (UVoxelChunk::ProceduralDensityVersion 포함)
+	static uint32 MakeDensitySettingsHash(const FChunkSettingInfo& Info);
+	// Mesh 결과에 영향을 주는 설정 Hash (Density 설정 + Mesher / 삼각형 예산 / LOD)
+	static uint32 MakeMeshSettingsHash(const FChunkSettingInfo& Info);
+
+	FString Directory;
+	const int64 MaxBytes;
+	mutable std::atomic<int64> DirectoryBytes{0};
+	mutable std::atomic<bool> bTrimming{false};
+};
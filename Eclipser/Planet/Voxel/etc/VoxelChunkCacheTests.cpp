@@ -0,0 +1,98 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "VoxelChunkCache.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Planet/Voxel/VoxelChunk.h"
+#include "Planet/Voxel/Benchmark/VoxelTestHelper.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkCacheTest, "Eclipser.Voxel.ChunkCache", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FVoxelChunkCacheTest::RunTest(const FString& Parameters)
+{
+	const FString Directory = FPaths::AutomationTransientDir() / TEXT("Voxel") / TEXT("ChunkCache");
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+	const FVoxelChunkCache Cache(Directory, 0);
+
+	FChunkSettingInfo Info = VoxelTestHelper::MakeTestInfo(16, 2);
+	Info.ChunkNum = 2;
+	Info.ChunkIndex = FIntVector(1, 1, 1);
+	Info.Calculate();
+
+	FChunkBuildResult Generated;
+	UVoxelChunk::GenerateChunkData(Info, nullptr, nullptr, Generated);
+
+	FChunkBuildResult Loaded;
+	AddErrorIfFalse(!Cache.LoadDensity(Info, 0, Loaded), TEXT("Empty cache returned density"));
+	AddErrorIfFalse(!Cache.LoadMesh(Info, 0, Loaded.MeshData), TEXT("Empty cache returned a mesh"));
+
+	Cache.WriteDensity(Info, FVoxelChunkCache::SerializeDensity(Info, 0, Generated.DensityData));
+	Cache.WriteMesh(Info, FVoxelChunkCache::SerializeMesh(Info, 0, Generated.MeshData));
+	if (AddErrorIfFalse(Cache.LoadDensity(Info, 0, Loaded), TEXT("Written density could not be loaded")))
+	{
+		AddErrorIfFalse(Loaded.DensityData.Num() == Generated.DensityData.Num()
+			&& FMemory::Memcmp(Loaded.DensityData.GetData(), Generated.DensityData.GetData(), Generated.DensityData.Num() * sizeof(FVertexDensity)) == 0,
+			TEXT("Loaded density differs from generated density"));
+		AddErrorIfFalse(Loaded.BrickMinMax.Max == Generated.BrickMinMax.Max && Loaded.BrickMinMax.Min == Generated.BrickMinMax.Min,
+			TEXT("Loaded brick min/max differs"));
+	}
+	if (AddErrorIfFalse(Cache.LoadMesh(Info, 0, Loaded.MeshData), TEXT("Written mesh could not be loaded")))
+	{
+		AddErrorIfFalse(VoxelTestHelper::HashMesh(Loaded.MeshData) == VoxelTestHelper::HashMesh(Generated.MeshData),
+			TEXT("Loaded mesh differs from generated mesh"));
+	}
+
+	// Sculpt Hash가 다르면 둘 다 사용하지 않아야 함
+	AddErrorIfFalse(!Cache.LoadDensity(Info, 1, Loaded), TEXT("Density was loaded with a different sculpt hash"));
+	AddErrorIfFalse(!Cache.LoadMesh(Info, 1, Loaded.MeshData), TEXT("Mesh was loaded with a different sculpt hash"));
+
+	// Density는 LOD / Mesher와 무관하게 공유, Mesh는 LOD / Mesher가 같을 때만 사용
+	FChunkSettingInfo OtherMesher = Info;
+	OtherMesher.MesherType = EVoxelMesherType::SurfaceNets;
+	AddErrorIfFalse(Cache.LoadDensity(OtherMesher, 0, Loaded), TEXT("Density was not shared with a different mesher"));
+	AddErrorIfFalse(!Cache.LoadMesh(OtherMesher, 0, Loaded.MeshData), TEXT("Mesh was loaded with a different mesher"));
+
+	FChunkSettingInfo OtherLOD = Info;
+	OtherLOD.LODLevel = 1;
+	AddErrorIfFalse(Cache.LoadDensity(OtherLOD, 0, Loaded), TEXT("Density was not shared with a different LOD"));
+	AddErrorIfFalse(!Cache.LoadMesh(OtherLOD, 0, Loaded.MeshData), TEXT("Mesh was loaded for a different LOD"));
+
+	// LOD별 Mesh를 더 써도 Density 파일은 Chunk당 하나
+	Cache.WriteMesh(OtherLOD, FVoxelChunkCache::SerializeMesh(OtherLOD, 0, Generated.MeshData));
+	TArray<FString> DensityFiles;
+	IFileManager::Get().FindFiles(DensityFiles, *(Directory / TEXT("*.vxd")), true, false);
+	AddErrorIfFalse(DensityFiles.Num() == 1, FString::Printf(TEXT("%d density files for one chunk"), DensityFiles.Num()));
+
+	// 한도를 넘으면 최근에 읽은 파일은 남기고 오래된 파일부터 삭제
+	{
+		const int64 EntryBytes = DensityFiles.Num() > 0 ? IFileManager::Get().FileSize(*(Directory / DensityFiles[0])) : 0;
+		const FString CappedDirectory = Directory / TEXT("Capped");
+		const FVoxelChunkCache CappedCache(CappedDirectory, EntryBytes * 8);
+
+		FChunkSettingInfo EntryInfo = Info;
+		for (int32 i = 0; i < 16; ++i)
+		{
+			EntryInfo.ChunkIndex = FIntVector(i, 0, 0);
+			CappedCache.WriteDensity(EntryInfo, FVoxelChunkCache::SerializeDensity(EntryInfo, 0, Generated.DensityData));
+
+			// 첫 Chunk는 계속 사용, 파일 시간 해상도보다 간격을 둠
+			EntryInfo.ChunkIndex = FIntVector(0, 0, 0);
+			CappedCache.LoadDensity(EntryInfo, 0, Loaded);
+			FPlatformProcess::Sleep(0.01f);
+		}
+
+		AddErrorIfFalse(CappedCache.GetDirectoryBytes() <= EntryBytes * 8,
+			FString::Printf(TEXT("Capped cache holds %lld bytes, limit %lld"), CappedCache.GetDirectoryBytes(), EntryBytes * 8));
+		AddErrorIfFalse(CappedCache.LoadDensity(EntryInfo, 0, Loaded), TEXT("Recently used entry was evicted"));
+		EntryInfo.ChunkIndex = FIntVector(1, 0, 0);
+		AddErrorIfFalse(!CappedCache.LoadDensity(EntryInfo, 0, Loaded), TEXT("Least recently used entry was kept"));
+	}
+
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+
+	return true;
+}
+
+#endif
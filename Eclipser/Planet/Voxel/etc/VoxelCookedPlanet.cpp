@@ -0,0 +1,314 @@
+#include "VoxelCookedPlanet.h"
+
+#include "Async/MappedFileHandle.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Planet/Voxel/VoxelChunk.h"
+#include "Planet/Voxel/Defines/VoxelStats.h"
+#include "Planet/Voxel/etc/VoxelHelper.h"
+#include "Planet/Voxel/etc/VoxelMeshSimplifier.h"
+#include "Planet/Voxel/etc/VoxelMesher.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	constexpr uint32 CookedPlanetMagic = 0x50435856; // "VXCP"
+	constexpr uint32 CookedPlanetVersion = 1;
+	constexpr int32 MaxCookedLODs = 16;
+	constexpr int32 MaxCookedChunkNum = 256;
+
+	void SerializeMesh(FArchive& Ar, FVoxelData& MeshData)
+	{
+		Ar << MeshData.Vertices << MeshData.Normals << MeshData.Colors << MeshData.Triangles;
+	}
+}
+
+FVoxelCookedPlanet::~FVoxelCookedPlanet()
+{
+	// Region을 먼저 해제한 뒤 Handle 해제
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+}
+
+bool FVoxelCookedPlanet::SerializeLayout(FArchive& Ar)
+{
+	uint32 Magic = CookedPlanetMagic;
+	uint32 Version = CookedPlanetVersion;
+	uint32 DensityVersion = UVoxelChunk::ProceduralDensityVersion;
+	Ar << Magic << Version << DensityVersion;
+	if (Ar.IsLoading() && (Magic != CookedPlanetMagic || Version != CookedPlanetVersion || DensityVersion != UVoxelChunk::ProceduralDensityVersion))
+		return false;
+
+	Ar << CellSize << CellNum << ChunkNum << Apron << DensityLayout << MesherType;
+	if (Ar.IsLoading() && (CellSize <= 0 || CellNum <= 0 || Apron < 1 || ChunkNum <= 0 || ChunkNum > MaxCookedChunkNum))
+		return false;
+
+	int32 LODNum = LODs.Num();
+	Ar << LODNum;
+	if (Ar.IsLoading())
+	{
+		if (LODNum < 0 || LODNum > MaxCookedLODs)
+			return false;
+		LODs.SetNum(LODNum);
+		Entries.SetNum(ChunkNum * ChunkNum * ChunkNum);
+	}
+
+	for (FBakeLOD& LOD : LODs)
+	{
+		Ar << LOD.LODLevel << LOD.TriangleBudget;
+	}
+
+	for (FChunkEntry& Entry : Entries)
+	{
+		Ar << Entry.Flags << Entry.Density;
+		Entry.Meshes.SetNum(LODNum);
+		for (FBlob& Mesh : Entry.Meshes)
+		{
+			Ar << Mesh;
+		}
+	}
+	return !Ar.IsError();
+}
+
+TSharedPtr<const FVoxelCookedPlanet, ESPMode::ThreadSafe> FVoxelCookedPlanet::Open(const FString& Path)
+{
+	const TSharedRef<FVoxelCookedPlanet, ESPMode::ThreadSafe> Planet = MakeShared<FVoxelCookedPlanet, ESPMode::ThreadSafe>();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	Planet->MappedHandle.Reset(PlatformFile.OpenMapped(*Path));
+	if (Planet->MappedHandle)
+	{
+		Planet->MappedRegion.Reset(Planet->MappedHandle->MapRegion(0, Planet->MappedHandle->GetFileSize()));
+	}
+
+	if (Planet->MappedRegion)
+	{
+		Planet->FileData = Planet->MappedRegion->GetMappedPtr();
+		Planet->FileSize = Planet->MappedRegion->GetMappedSize();
+	}
+	else
+	{
+		if (!FFileHelper::LoadFileToArray(Planet->FallbackBytes, *Path, FILEREAD_Silent))
+			return nullptr;
+		Planet->FileData = Planet->FallbackBytes.GetData();
+		Planet->FileSize = Planet->FallbackBytes.Num();
+	}
+
+	// Header와 Chunk Table만 메모리로 읽고 Blob은 필요할 때 Map된 영역에서 바로 압축 해제
+	FMemoryReaderView Reader(TArrayView64<const uint8>(Planet->FileData, Planet->FileSize));
+	if (!Planet->SerializeLayout(Reader))
+		return nullptr;
+
+	return Planet;
+}
+
+bool FVoxelCookedPlanet::IsCompatible(const FChunkSettingInfo& Info) const
+{
+	return Info.CellSize == CellSize && Info.CellNum == CellNum && Info.ChunkNum == ChunkNum
+		&& Info.Apron == Apron && Info.DensityLayout == DensityLayout;
+}
+
+bool FVoxelCookedPlanet::LoadDensity(const FChunkSettingInfo& Info, TArray<FVertexDensity>& OutDensityData) const
+{
+	VOXEL_SCOPE_STAGE(CookedLoad);
+
+	const FChunkEntry* Entry = FindEntry(Info);
+	if (!Entry)
+		return false;
+
+	const int32 DensityNum = VoxelHelper::GetDensityDataNum(Info);
+	if (Entry->Density.UncompressedSize != DensityNum * static_cast<int32>(sizeof(FVertexDensity)))
+		return false;
+
+	OutDensityData.SetNumUninitialized(DensityNum, EAllowShrinking::No);
+	return Decompress(Entry->Density, reinterpret_cast<uint8*>(OutDensityData.GetData()));
+}
+
+bool FVoxelCookedPlanet::LoadMesh(const FChunkSettingInfo& Info, FVoxelData& OutMeshData) const
+{
+	VOXEL_SCOPE_STAGE(CookedLoad);
+
+	const FChunkEntry* Entry = FindEntry(Info);
+	if (!Entry || Info.MesherType != MesherType)
+		return false;
+
+	if (Entry->Flags & Homogeneous)
+	{
+		OutMeshData.Vertices.Reset();
+		OutMeshData.Normals.Reset();
+		OutMeshData.Colors.Reset();
+		OutMeshData.Triangles.Reset();
+		return true;
+	}
+
+	const int32 LODIndex = LODs.IndexOfByPredicate([&Info](const FBakeLOD& LOD)
+	{
+		return LOD.LODLevel == Info.LODLevel && LOD.TriangleBudget == Info.TriangleBudget;
+	});
+	if (LODIndex == INDEX_NONE)
+		return false;
+
+	const FBlob& Blob = Entry->Meshes[LODIndex];
+	TArray<uint8> Bytes;
+	Bytes.SetNumUninitialized(Blob.UncompressedSize);
+	if (!Decompress(Blob, Bytes.GetData()))
+		return false;
+
+	FMemoryReader Reader(Bytes);
+	SerializeMesh(Reader, OutMeshData);
+	return !Reader.IsError();
+}
+
+const FVoxelCookedPlanet::FChunkEntry* FVoxelCookedPlanet::FindEntry(const FChunkSettingInfo& Info) const
+{
+	if (!IsCompatible(Info))
+		return nullptr;
+
+	const FIntVector& Index = Info.ChunkIndex;
+	if (Index.X < 0 || Index.Y < 0 || Index.Z < 0 || Index.X >= ChunkNum || Index.Y >= ChunkNum || Index.Z >= ChunkNum)
+		return nullptr;
+
+	return &Entries[Index.X + Index.Y * ChunkNum + Index.Z * ChunkNum * ChunkNum];
+}
+
+bool FVoxelCookedPlanet::Decompress(const FBlob& Blob, uint8* OutBytes) const
+{
+	if (Blob.CompressedSize <= 0 || Blob.UncompressedSize <= 0 || Blob.Offset < 0 || Blob.Offset + Blob.CompressedSize > FileSize)
+		return false;
+
+	return FCompression::UncompressMemory(NAME_Oodle, OutBytes, Blob.UncompressedSize, FileData + Blob.Offset, Blob.CompressedSize);
+}
+
+FVoxelCookedPlanet::FBlob FVoxelCookedPlanet::Compress(const TArray<uint8>& Bytes, TArray<uint8>& InOutBlobData)
+{
+	FBlob Blob;
+	if (Bytes.Num() == 0)
+		return Blob;
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, Bytes.Num());
+	const int64 Offset = InOutBlobData.Num();
+	InOutBlobData.AddUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Oodle, InOutBlobData.GetData() + Offset, CompressedSize, Bytes.GetData(), Bytes.Num()))
+	{
+		InOutBlobData.SetNum(Offset);
+		return Blob;
+	}
+	InOutBlobData.SetNum(Offset + CompressedSize);
+
+	Blob.Offset = Offset;
+	Blob.CompressedSize = CompressedSize;
+	Blob.UncompressedSize = Bytes.Num();
+	return Blob;
+}
+
+bool FVoxelCookedPlanet::Bake(const FChunkSettingInfo& BaseInfo, TConstArrayView<FBakeLOD> InLODs, const FString& Path, int64& OutFileSize)
+{
+	FVoxelCookedPlanet Layout;
+	Layout.CellSize = BaseInfo.CellSize;
+	Layout.CellNum = BaseInfo.CellNum;
+	Layout.ChunkNum = BaseInfo.ChunkNum;
+	Layout.Apron = BaseInfo.Apron;
+	Layout.DensityLayout = BaseInfo.DensityLayout;
+	Layout.MesherType = BaseInfo.MesherType;
+	Layout.LODs.Append(InLODs.GetData(), InLODs.Num());
+
+	const int32 ChunkCount = BaseInfo.ChunkNum * BaseInfo.ChunkNum * BaseInfo.ChunkNum;
+	Layout.Entries.SetNum(ChunkCount);
+
+	// Chunk별 Blob은 각자 버퍼에 모으고, Header 크기가 정해진 뒤 파일 Offset으로 바꿈
+	TArray<TArray<uint8>> ChunkBlobData;
+	ChunkBlobData.SetNum(ChunkCount);
+
+	ParallelFor(ChunkCount, [&](int32 EntryIndex)
+	{
+		const int32 ChunkNum = BaseInfo.ChunkNum;
+		FChunkSettingInfo Info = BaseInfo;
+		Info.ChunkIndex = FIntVector(EntryIndex % ChunkNum, (EntryIndex / ChunkNum) % ChunkNum, EntryIndex / (ChunkNum * ChunkNum));
+		Info.LODLevel = 1;
+		Info.TriangleBudget = 0;
+		Info.Calculate();
+
+		TArray<FVertexDensity> DensityData;
+		UVoxelChunk::GenerateChunkDensityData(Info, DensityData, nullptr, nullptr);
+
+		FChunkEntry& Entry = Layout.Entries[EntryIndex];
+		TArray<uint8>& BlobData = ChunkBlobData[EntryIndex];
+
+		// Marching Cubes와 같은 기준 (Density < 0 이면 빈 공간)
+		bool bHasSolid = false;
+		bool bHasEmpty = false;
+		for (const FVertexDensity& Vertex : DensityData)
+		{
+			if (Vertex.Density < 0.0f)
+				bHasEmpty = true;
+			else
+				bHasSolid = true;
+		}
+		Entry.Flags = bHasSolid && bHasEmpty ? 0 : static_cast<uint8>(Homogeneous);
+
+		TArray<uint8> Bytes(reinterpret_cast<const uint8*>(DensityData.GetData()), DensityData.Num() * sizeof(FVertexDensity));
+		Entry.Density = Compress(Bytes, BlobData);
+
+		Entry.Meshes.SetNum(InLODs.Num());
+		if (Entry.Flags & Homogeneous)
+			return;
+
+		FVoxelBrickMinMax BrickMinMax;
+		VoxelHelper::BuildBrickMinMax(Info, DensityData, BrickMinMax);
+		for (int32 i = 0; i < InLODs.Num(); ++i)
+		{
+			FChunkSettingInfo LODInfo = Info;
+			LODInfo.LODLevel = InLODs[i].LODLevel;
+			LODInfo.Calculate();
+
+			FVoxelData MeshData;
+			VoxelMesher::GenerateChunkMesh(LODInfo, DensityData, MeshData, &BrickMinMax);
+			VoxelMeshSimplifier::Simplify(MeshData, InLODs[i].TriangleBudget);
+
+			Bytes.Reset();
+			FMemoryWriter Writer(Bytes);
+			SerializeMesh(Writer, MeshData);
+			Entry.Meshes[i] = Compress(Bytes, BlobData);
+		}
+	});
+
+	// Table은 고정 크기라 Offset 값과 관계없이 Header 크기가 같음
+	TArray<uint8> FileBytes;
+	{
+		FMemoryWriter SizeWriter(FileBytes);
+		Layout.SerializeLayout(SizeWriter);
+	}
+
+	int64 BlobOffset = FileBytes.Num();
+	for (int32 i = 0; i < ChunkCount; ++i)
+	{
+		FChunkEntry& Entry = Layout.Entries[i];
+		auto Relocate = [BlobOffset](FBlob& Blob)
+		{
+			if (Blob.CompressedSize > 0)
+			{
+				Blob.Offset += BlobOffset;
+			}
+		};
+		Relocate(Entry.Density);
+		for (FBlob& Mesh : Entry.Meshes)
+		{
+			Relocate(Mesh);
+		}
+		BlobOffset += ChunkBlobData[i].Num();
+	}
+
+	FileBytes.Reset();
+	FMemoryWriter Writer(FileBytes);
+	Layout.SerializeLayout(Writer);
+	for (const TArray<uint8>& BlobData : ChunkBlobData)
+	{
+		FileBytes.Append(BlobData);
+	}
+
+	OutFileSize = FileBytes.Num();
+	return FFileHelper::SaveArrayToFile(FileBytes, *Path);
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Planet/Voxel/Defines/VoxelStructs.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/*
+ * VoxelBake Commandlet이 미리 만든 Planet 파일 (Chunk별 압축 Density, LOD별 기본 Mesh, 부호가 한 가지인 Chunk Flag)
+ * 파일은 Memory Map으로 열어서 Build Task가 필요한 Chunk 부분만 읽고 압축을 풂, 읽기 전용이라 여러 스레드에서 동시에 사용 가능
+ *
+ * 파일 구조 : Header -> LOD 목록 -> Chunk Table (ChunkNum^3, X 우선) -> 압축 Blob
+ */
+class FVoxelCookedPlanet
+{
+public:
+	~FVoxelCookedPlanet();
+
+	// 파일이 없거나 형식 / ProceduralDensityVersion이 다르면 nullptr
+	static TSharedPtr<const FVoxelCookedPlanet, ESPMode::ThreadSafe> Open(const FString& Path);
+
+	// BaseInfo의 LOD / Mesher / 삼각형 예산을 빼고 Density 배치가 같은지
+	bool IsCompatible(const FChunkSettingInfo& Info) const;
+
+	bool LoadDensity(const FChunkSettingInfo& Info, TArray<FVertexDensity>& OutDensityData) const;
+	// 같은 Mesher / LOD / 삼각형 예산으로 구운 Mesh가 있을 때만 true, 부호가 한 가지인 Chunk는 모든 LOD에서 빈 Mesh
+	bool LoadMesh(const FChunkSettingInfo& Info, FVoxelData& OutMeshData) const;
+
+	/* Bake */
+	struct FBakeLOD
+	{
+		int32 LODLevel = 1;
+		int32 TriangleBudget = 0;
+	};
+	// BaseInfo의 ChunkIndex / LODLevel은 무시하고 모든 Chunk를 생성해서 Path에 저장
+	static bool Bake(const FChunkSettingInfo& BaseInfo, TConstArrayView<FBakeLOD> LODs, const FString& Path, int64& OutFileSize);
+
+private:
+	struct FBlob
+	{
+		int64 Offset = 0;
+		int32 CompressedSize = 0;
+		int32 UncompressedSize = 0;
+
+		friend FArchive& operator<<(FArchive& Ar, FBlob& Blob)
+		{
+			return Ar << Blob.Offset << Blob.CompressedSize << Blob.UncompressedSize;
+		}
+	};
+
+	enum EChunkFlags : uint8
+	{
+		// Apron까지 모든 꼭짓점의 부호가 같아서 어떤 LOD에서도 표면이 없음
+		Homogeneous = 1 << 0,
+	};
+
+	struct FChunkEntry
+	{
+		uint8 Flags = 0;
+		FBlob Density;
+		TArray<FBlob> Meshes; // LODs와 같은 순서
+	};
+
+	// 읽기 / 쓰기 공용, 읽을 때 Magic / Version이 다르면 false
+	bool SerializeLayout(FArchive& Ar);
+	const FChunkEntry* FindEntry(const FChunkSettingInfo& Info) const;
+	// OutBytes는 Blob.UncompressedSize 크기
+	bool Decompress(const FBlob& Blob, uint8* OutBytes) const;
+	static FBlob Compress(const TArray<uint8>& Bytes, TArray<uint8>& InOutBlobData);
+
+	int32 CellSize = 0;
+	int32 CellNum = 0;
+	int32 ChunkNum = 0;
+	int32 Apron = 0;
+	EVoxelDensityLayout DensityLayout = EVoxelDensityLayout::Linear;
+	EVoxelMesherType MesherType = EVoxelMesherType::MarchingCubes;
+	TArray<FBakeLOD> LODs;
+	TArray<FChunkEntry> Entries;
+
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	// Memory Map을 지원하지 않는 Platform에서는 파일 전체를 읽어서 사용
+	TArray<uint8> FallbackBytes;
+	const uint8* FileData = nullptr;
+	int64 FileSize = 0;
+};
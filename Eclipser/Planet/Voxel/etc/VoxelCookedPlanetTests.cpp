@@ -0,0 +1,86 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "VoxelCookedPlanet.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Planet/Voxel/VoxelChunk.h"
+#include "Planet/Voxel/Benchmark/VoxelTestHelper.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelCookedPlanetTest, "Eclipser.Voxel.CookedPlanet", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FVoxelCookedPlanetTest::RunTest(const FString& Parameters)
+{
+	const FString Path = FPaths::AutomationTransientDir() / TEXT("Voxel") / TEXT("Planet.vxp");
+
+	FChunkSettingInfo BaseInfo = VoxelTestHelper::MakeTestInfo(16, 1);
+	BaseInfo.ChunkNum = 2;
+	const FVoxelCookedPlanet::FBakeLOD LODs[] = { {1, 0}, {2, 0} };
+
+	int64 FileSize = 0;
+	if (!AddErrorIfFalse(FVoxelCookedPlanet::Bake(BaseInfo, LODs, Path, FileSize), TEXT("Bake failed")))
+		return false;
+
+	const TSharedPtr<const FVoxelCookedPlanet, ESPMode::ThreadSafe> Cooked = FVoxelCookedPlanet::Open(Path);
+	if (!AddErrorIfFalse(Cooked.IsValid() && Cooked->IsCompatible(BaseInfo), TEXT("Baked planet could not be opened")))
+		return false;
+
+	// 구운 결과는 절차적 생성 결과와 같아야 함
+	FChunkSettingInfo SurfaceInfo = BaseInfo;
+	for (int32 z = 0; z < BaseInfo.ChunkNum; ++z)
+		for (int32 y = 0; y < BaseInfo.ChunkNum; ++y)
+			for (int32 x = 0; x < BaseInfo.ChunkNum; ++x)
+			{
+				for (const FVoxelCookedPlanet::FBakeLOD& LOD : LODs)
+				{
+					FChunkSettingInfo Info = BaseInfo;
+					Info.ChunkIndex = FIntVector(x, y, z);
+					Info.LODLevel = LOD.LODLevel;
+					Info.Calculate();
+					const FString Label = FString::Printf(TEXT("Chunk=%s LOD=%d"), *Info.ChunkIndex.ToString(), Info.LODLevel);
+
+					FChunkBuildResult Generated;
+					UVoxelChunk::GenerateChunkData(Info, nullptr, nullptr, Generated);
+					if (Generated.MeshData.Triangles.Num() > 0)
+					{
+						SurfaceInfo = Info;
+					}
+
+					TArray<FVertexDensity> DensityData;
+					if (AddErrorIfFalse(Cooked->LoadDensity(Info, DensityData), FString::Printf(TEXT("%s: density missing"), *Label)))
+					{
+						AddErrorIfFalse(DensityData.Num() == Generated.DensityData.Num()
+							&& FMemory::Memcmp(DensityData.GetData(), Generated.DensityData.GetData(), DensityData.Num() * sizeof(FVertexDensity)) == 0,
+							FString::Printf(TEXT("%s: cooked density differs"), *Label));
+					}
+
+					FVoxelData MeshData;
+					if (AddErrorIfFalse(Cooked->LoadMesh(Info, MeshData), FString::Printf(TEXT("%s: mesh missing"), *Label)))
+					{
+						AddErrorIfFalse(VoxelTestHelper::HashMesh(MeshData) == VoxelTestHelper::HashMesh(Generated.MeshData),
+							FString::Printf(TEXT("%s: cooked mesh differs"), *Label));
+					}
+				}
+			}
+
+	// 표면이 있는 Chunk는 굽지 않은 LOD / 예산 / Mesher의 Mesh를 사용하지 않아야 함
+	FVoxelData Unused;
+	FChunkSettingInfo OtherLOD = SurfaceInfo;
+	OtherLOD.LODLevel = 4;
+	AddErrorIfFalse(!Cooked->LoadMesh(OtherLOD, Unused), TEXT("Mesh was loaded for an LOD that was not baked"));
+
+	FChunkSettingInfo OtherBudget = SurfaceInfo;
+	OtherBudget.TriangleBudget = 100;
+	AddErrorIfFalse(!Cooked->LoadMesh(OtherBudget, Unused), TEXT("Mesh was loaded for a different triangle budget"));
+
+	FChunkSettingInfo OtherMesher = SurfaceInfo;
+	OtherMesher.MesherType = EVoxelMesherType::SurfaceNets;
+	AddErrorIfFalse(!Cooked->LoadMesh(OtherMesher, Unused), TEXT("Mesh was loaded for a different mesher"));
+
+	IFileManager::Get().Delete(*Path);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,72 @@
+#include "VoxelDensityBatch.h"
+
+void FVoxelDensityBatch::AddChunk(const FIntVector& ChunkIndex)
+{
+	FScopeLock ScopeLock(&Lock);
+	PendingChunks.Add(ChunkIndex);
+}
+
+void FVoxelDensityBatch::BeginChunk(const FIntVector& ChunkIndex, TArray<TPair<FIntVector, FDensitySnapshot>>& OutNeighbors)
+{
+	FScopeLock ScopeLock(&Lock);
+	PendingChunks.Remove(ChunkIndex);
+
+	for (int32 dz = -1; dz <= 1; ++dz)
+		for (int32 dy = -1; dy <= 1; ++dy)
+			for (int32 dx = -1; dx <= 1; ++dx)
+			{
+				const FIntVector Offset(dx, dy, dz);
+				if (Offset == FIntVector::ZeroValue)
+					continue;
+
+				const FIntVector NeighborIndex = ChunkIndex + Offset;
+				const FDensitySnapshot* Snapshot = PublishedDensity.Find(NeighborIndex);
+				if (!Snapshot)
+					continue;
+
+				OutNeighbors.Emplace(Offset, *Snapshot);
+
+				// 이웃을 기다리는 Chunk가 더 없으면 해제 (복사해 간 포인터는 사용이 끝날 때까지 유지됨)
+				if (!HasPendingNeighbor(NeighborIndex))
+				{
+					PublishedBytes -= (*Snapshot)->GetAllocatedSize();
+					PublishedDensity.Remove(NeighborIndex);
+				}
+			}
+}
+
+void FVoxelDensityBatch::SkipChunk(const FIntVector& ChunkIndex)
+{
+	// 이 Chunk만 기다리던 이웃의 공개 Density도 같이 해제됨
+	TArray<TPair<FIntVector, FDensitySnapshot>> Unused;
+	BeginChunk(ChunkIndex, Unused);
+}
+
+void FVoxelDensityBatch::PublishChunk(const FIntVector& ChunkIndex, const TArray<FVertexDensity>& DensityData)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (!HasPendingNeighbor(ChunkIndex))
+		return;
+
+	TArray<float> Densities;
+	Densities.SetNumUninitialized(DensityData.Num());
+	for (int32 i = 0; i < DensityData.Num(); ++i)
+	{
+		Densities[i] = DensityData[i].Density;
+	}
+
+	PublishedBytes += Densities.GetAllocatedSize();
+	PublishedDensity.Add(ChunkIndex, MakeShared<TArray<float>, ESPMode::ThreadSafe>(MoveTemp(Densities)));
+}
+
+bool FVoxelDensityBatch::HasPendingNeighbor(const FIntVector& ChunkIndex) const
+{
+	for (int32 dz = -1; dz <= 1; ++dz)
+		for (int32 dy = -1; dy <= 1; ++dy)
+			for (int32 dx = -1; dx <= 1; ++dx)
+			{
+				if ((dx != 0 || dy != 0 || dz != 0) && PendingChunks.Contains(ChunkIndex + FIntVector(dx, dy, dz)))
+					return true;
+			}
+	return false;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Planet/Voxel/Defines/VoxelStructs.h"
+
+/*
+ * 같은 요청 묶음(Batch)으로 생성되는 Chunk끼리 겹치는 Density(경계면 + Apron)를 공유하기 위한 객체
+ * 먼저 끝난 Chunk가 Sculpt 적용 전의 Density를 공개하고, 나중에 시작하는 이웃 Chunk는 겹치는 영역을 복사해서 사용
+ * 공개된 Density는 모든 이웃이 생성을 시작하면 해제됨
+ */
+class FVoxelDensityBatch
+{
+public:
+	using FDensitySnapshot = TSharedPtr<const TArray<float>, ESPMode::ThreadSafe>;
+
+	// Task 실행 전에 Batch에 포함된 Chunk를 모두 등록
+	void AddChunk(const FIntVector& ChunkIndex);
+
+	// 생성 시작, 이미 공개된 이웃 Chunk의 Density를 반환
+	void BeginChunk(const FIntVector& ChunkIndex, TArray<TPair<FIntVector, FDensitySnapshot>>& OutNeighbors);
+
+	// Cache 등으로 생성하지 않는 Chunk, 이웃 Density를 가져가지 않고 시작한 것으로 처리
+	void SkipChunk(const FIntVector& ChunkIndex);
+
+	// 아직 시작하지 않은 이웃이 있으면 Density를 공개
+	void PublishChunk(const FIntVector& ChunkIndex, const TArray<FVertexDensity>& DensityData);
+
+	// 공개 중인 Density 크기, Manager 메모리 예산에 포함
+	int64 GetPublishedBytes() const { return PublishedBytes.load(std::memory_order_relaxed); }
+
+private:
+	bool HasPendingNeighbor(const FIntVector& ChunkIndex) const;
+
+	FCriticalSection Lock;
+	TSet<FIntVector> PendingChunks;
+	TMap<FIntVector, FDensitySnapshot> PublishedDensity;
+	std::atomic<int64> PublishedBytes{0};
+};
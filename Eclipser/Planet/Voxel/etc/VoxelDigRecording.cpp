@@ -0,0 +1,73 @@
+#include "VoxelDigRecording.h"
+
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	constexpr uint32 DigRecordingMagic = 0x47494456; // "VDIG"
+	constexpr uint32 DigRecordingVersion = 1;
+}
+
+FArchive& operator<<(FArchive& Ar, FVoxelDigRecording& Recording)
+{
+	uint32 Magic = DigRecordingMagic;
+	uint32 Version = DigRecordingVersion;
+	Ar << Magic << Version;
+	if (Ar.IsLoading() && (Magic != DigRecordingMagic || Version != DigRecordingVersion))
+	{
+		Ar.SetError();
+		return Ar;
+	}
+
+	Ar << Recording.CellSize << Recording.CellNum << Recording.ChunkNum;
+
+	int32 EventNum = Recording.Events.Num();
+	Ar << EventNum;
+	if (Ar.IsLoading())
+	{
+		if (EventNum < 0)
+		{
+			Ar.SetError();
+			return Ar;
+		}
+		Recording.Events.SetNum(EventNum);
+	}
+
+	// 기준 위치 Event에는 Radius를 저장하지 않음
+	for (FVoxelDigEvent& Event : Recording.Events)
+	{
+		Ar << Event.Type << Event.Time << Event.Location;
+		if (Event.Type == EVoxelDigEventType::Sculpt)
+		{
+			Ar << Event.Radius;
+		}
+	}
+	return Ar;
+}
+
+bool FVoxelDigRecording::SaveToFile(const FString& Path) const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Writer << const_cast<FVoxelDigRecording&>(*this);
+	return FFileHelper::SaveArrayToFile(Bytes, *Path);
+}
+
+bool FVoxelDigRecording::LoadFromFile(const FString& Path)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+		return false;
+
+	FMemoryReader Reader(Bytes);
+	Reader << *this;
+	return !Reader.IsError();
+}
+
+FString FVoxelDigRecording::MakeDefaultPath(const FString& Name)
+{
+	return FPaths::ProjectSavedDir() / TEXT("VoxelRecordings") / FString::Printf(TEXT("Dig_%s_%s.vdig"), *Name, *FDateTime::Now().ToString());
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EVoxelDigEventType : uint8
+{
+	Reference, // LOD / Collision 기준 위치 이동
+	Sculpt,
+};
+
+struct FVoxelDigEvent
+{
+	EVoxelDigEventType Type = EVoxelDigEventType::Reference;
+	float Time = 0.0f; // 기록 시작 기준 초
+	FVector3f Location = FVector3f::ZeroVector; // Manager 위치 기준 좌표
+	float Radius = 0.0f; // Sculpt만 사용
+};
+
+// Replay 동안 측정한 Frame 시간 요약
+struct FVoxelDigReplayStats
+{
+	int32 Frames = 0;
+	int32 SculptCount = 0;
+	double AvgFrameMs = 0.0;
+	double P95FrameMs = 0.0;
+	double MaxFrameMs = 0.0;
+};
+
+/*
+ * Dig 세션 기록 : Sculpt 호출과 기준 위치 경로를 시간 순서대로 저장
+ * 같은 Planet 설정에서 Replay하면 같은 시간에 같은 Sculpt를 다시 실행하므로 Sculpt/Remesh 최적화의 반복 가능한 부하 테스트로 사용
+ */
+class FVoxelDigRecording
+{
+public:
+	int32 CellSize = 0;
+	int32 CellNum = 0;
+	int32 ChunkNum = 0;
+	TArray<FVoxelDigEvent> Events;
+
+	float GetDuration() const { return Events.Num() > 0 ? Events.Last().Time : 0.0f; }
+
+	bool SaveToFile(const FString& Path) const;
+	bool LoadFromFile(const FString& Path);
+
+	static FString MakeDefaultPath(const FString& Name);
+
+	friend FArchive& operator<<(FArchive& Ar, FVoxelDigRecording& Recording);
+};
@@ -1,6 +1,67 @@
 #include "VoxelHelper.h"
 
-int32 VoxelHelper::GetIndex(int X, int Y, int Z, int CellNum)
+void VoxelHelper::GetBrickCornerRange(const FChunkSettingInfo& Info, int32 Brick, int32& OutMin, int32& OutMax)
 {
-	return X + Y * (CellNum + 1) + Z * (CellNum + 1) * (CellNum + 1);
+	const int32 BrickNum = FMath::DivideAndRoundUp(Info.CellNum, FVoxelBrickMinMax::BrickSize);
+	OutMin = Brick == 0 ? -Info.Apron : Brick * FVoxelBrickMinMax::BrickSize;
+	OutMax = Brick == BrickNum - 1 ? Info.CellNum + Info.Apron : (Brick + 1) * FVoxelBrickMinMax::BrickSize;
+}
+
+void VoxelHelper::BuildBrickMinMax(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& DensityData, FVoxelBrickMinMax& OutBricks)
+{
+	OutBricks.BrickNum = FMath::DivideAndRoundUp(Info.CellNum, FVoxelBrickMinMax::BrickSize);
+	const int32 BrickCount = OutBricks.BrickNum * OutBricks.BrickNum * OutBricks.BrickNum;
+	OutBricks.Min.SetNumUninitialized(BrickCount, EAllowShrinking::No);
+	OutBricks.Max.SetNumUninitialized(BrickCount, EAllowShrinking::No);
+
+	for (int32 Bz = 0; Bz < OutBricks.BrickNum; ++Bz)
+		for (int32 By = 0; By < OutBricks.BrickNum; ++By)
+			for (int32 Bx = 0; Bx < OutBricks.BrickNum; ++Bx)
+			{
+				ComputeBrick(Info, DensityData, Bx, By, Bz, OutBricks);
+			}
+}
+
+void VoxelHelper::UpdateBrickMinMax(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& DensityData,
+	const FIntVector& MinCorner, const FIntVector& MaxCorner, FVoxelBrickMinMax& InOutBricks)
+{
+	if (!InOutBricks.IsValid())
+		return;
+
+	// Brick 경계 꼭짓점은 아래쪽 Brick에도 포함되므로 한 칸 아래부터 검사
+	const FIntVector StartBrick(
+		InOutBricks.CornerToBrick(MinCorner.X - 1), InOutBricks.CornerToBrick(MinCorner.Y - 1), InOutBricks.CornerToBrick(MinCorner.Z - 1));
+	const FIntVector EndBrick(
+		InOutBricks.CornerToBrick(MaxCorner.X), InOutBricks.CornerToBrick(MaxCorner.Y), InOutBricks.CornerToBrick(MaxCorner.Z));
+
+	for (int32 Bz = StartBrick.Z; Bz <= EndBrick.Z; ++Bz)
+		for (int32 By = StartBrick.Y; By <= EndBrick.Y; ++By)
+			for (int32 Bx = StartBrick.X; Bx <= EndBrick.X; ++Bx)
+			{
+				ComputeBrick(Info, DensityData, Bx, By, Bz, InOutBricks);
+			}
+}
+
+void VoxelHelper::ComputeBrick(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& DensityData, int32 Bx, int32 By, int32 Bz,
+	FVoxelBrickMinMax& InOutBricks)
+{
+	int32 MinX, MaxX, MinY, MaxY, MinZ, MaxZ;
+	GetBrickCornerRange(Info, Bx, MinX, MaxX);
+	GetBrickCornerRange(Info, By, MinY, MaxY);
+	GetBrickCornerRange(Info, Bz, MinZ, MaxZ);
+
+	float BrickMin = TNumericLimits<float>::Max();
+	float BrickMax = TNumericLimits<float>::Lowest();
+	for (int32 z = MinZ; z <= MaxZ; ++z)
+		for (int32 y = MinY; y <= MaxY; ++y)
+			for (int32 x = MinX; x <= MaxX; ++x)
+			{
+				const float Density = DensityData[GetIndex(x, y, z, Info)].Density;
+				BrickMin = FMath::Min(BrickMin, Density);
+				BrickMax = FMath::Max(BrickMax, Density);
+			}
+
+	const int32 BrickIndex = InOutBricks.GetBrickIndex(Bx, By, Bz);
+	InOutBricks.Min[BrickIndex] = BrickMin;
+	InOutBricks.Max[BrickIndex] = BrickMax;
 }
@@ -1,7 +1,61 @@
 #pragma once
 
+#include "Planet/Voxel/Defines/VoxelStructs.h"
+
 class VoxelHelper
 {
 public:
-	static int32 GetIndex(int X, int Y, int Z, int CellNum);
+	// X, Y, Z는 -Info.Apron ~ CellNum + Info.Apron 범위의 Chunk Local 꼭짓점 Index, Info.DensityLayout에 따라 배치가 다름
+	static int32 GetIndex(int X, int Y, int Z, const FChunkSettingInfo& Info);
+	static int32 GetDensityDataNum(const FChunkSettingInfo& Info);
+
+	static constexpr int32 DensityTileShift = 2;
+	static constexpr int32 DensityTileSize = 1 << DensityTileShift;
+
+	// Brick 하나가 포함하는 꼭짓점 범위 (양 끝 포함)
+	static void GetBrickCornerRange(const FChunkSettingInfo& Info, int32 Brick, int32& OutMin, int32& OutMax);
+	static void BuildBrickMinMax(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& DensityData, FVoxelBrickMinMax& OutBricks);
+	// MinCorner ~ MaxCorner 꼭짓점을 포함하는 Brick만 다시 계산
+	static void UpdateBrickMinMax(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& DensityData,
+		const FIntVector& MinCorner, const FIntVector& MaxCorner, FVoxelBrickMinMax& InOutBricks);
+
+private:
+	// Tile 안 좌표(0 ~ 3) -> Morton Bit, 세 축 값을 OR 하면 Tile 안 Index
+	static constexpr int32 MortonX[DensityTileSize] = { 0, 1, 8, 9 };
+	static constexpr int32 MortonY[DensityTileSize] = { 0, 2, 16, 18 };
+	static constexpr int32 MortonZ[DensityTileSize] = { 0, 4, 32, 36 };
+
+	static void ComputeBrick(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& DensityData, int32 Bx, int32 By, int32 Bz,
+		FVoxelBrickMinMax& InOutBricks);
 };
+
+FORCEINLINE int32 VoxelHelper::GetIndex(int X, int Y, int Z, const FChunkSettingInfo& Info)
+{
+	const int32 Dim = Info.CellNum + 1 + Info.Apron * 2;
+	const int32 PX = X + Info.Apron;
+	const int32 PY = Y + Info.Apron;
+	const int32 PZ = Z + Info.Apron;
+
+	if (Info.DensityLayout == EVoxelDensityLayout::Tiled)
+	{
+		constexpr int32 TileMask = DensityTileSize - 1;
+		const int32 TileDim = (Dim + TileMask) >> DensityTileShift;
+		const int32 TileIndex = (PX >> DensityTileShift) + ((PY >> DensityTileShift) + (PZ >> DensityTileShift) * TileDim) * TileDim;
+		return (TileIndex << (DensityTileShift * 3)) | MortonX[PX & TileMask] | MortonY[PY & TileMask] | MortonZ[PZ & TileMask];
+	}
+
+	return PX + PY * Dim + PZ * Dim * Dim;
+}
+
+FORCEINLINE int32 VoxelHelper::GetDensityDataNum(const FChunkSettingInfo& Info)
+{
+	const int32 Dim = Info.CellNum + 1 + Info.Apron * 2;
+	if (Info.DensityLayout == EVoxelDensityLayout::Tiled)
+	{
+		// 마지막 Tile은 남는 칸까지 포함
+		const int32 TileDim = FMath::DivideAndRoundUp(Dim, DensityTileSize);
+		return TileDim * TileDim * TileDim * DensityTileSize * DensityTileSize * DensityTileSize;
+	}
+
+	return Dim * Dim * Dim;
+}
@@ -0,0 +1,66 @@
+#include "VoxelMeshSimplifier.h"
+
+#include "DynamicMesh/DynamicMesh3.h"
+#include "MeshSimplification.h"
+#include "Planet/Voxel/Defines/VoxelStats.h"
+
+using namespace UE::Geometry;
+
+void VoxelMeshSimplifier::Simplify(FVoxelData& InOutMeshData, int32 TriangleBudget)
+{
+	const int32 TriangleNum = InOutMeshData.Triangles.Num() / 3;
+	if (TriangleBudget <= 0 || TriangleNum <= TriangleBudget)
+		return;
+
+	VOXEL_SCOPE_STAGE(Simplify);
+
+	FDynamicMesh3 Mesh;
+	Mesh.EnableVertexNormals(FVector3f::UnitZ());
+	for (int32 i = 0; i < InOutMeshData.Vertices.Num(); ++i)
+	{
+		const int32 VertexId = Mesh.AppendVertex(InOutMeshData.Vertices[i]);
+		Mesh.SetVertexNormal(VertexId, FVector3f(InOutMeshData.Normals[i]));
+	}
+
+	for (int32 t = 0; t < TriangleNum; ++t)
+	{
+		// Non-manifold 삼각형이 있으면 빠진 자리가 구멍이 되므로 단순화하지 않음
+		if (Mesh.AppendTriangle(InOutMeshData.Triangles[t * 3], InOutMeshData.Triangles[t * 3 + 1], InOutMeshData.Triangles[t * 3 + 2]) < 0)
+			return;
+	}
+
+	// Chunk 경계는 Mesh의 열린 경계이므로 경계 Edge와 정점을 움직이지 않음
+	FMeshConstraints Constraints;
+	for (const int32 EdgeId : Mesh.BoundaryEdgeIndicesItr())
+	{
+		Constraints.SetOrUpdateEdgeConstraint(EdgeId, FEdgeConstraint::FullyConstrained());
+		const FIndex2i EdgeVertices = Mesh.GetEdgeV(EdgeId);
+		Constraints.SetOrUpdateVertexConstraint(EdgeVertices.A, FVertexConstraint::FullyConstrained());
+		Constraints.SetOrUpdateVertexConstraint(EdgeVertices.B, FVertexConstraint::FullyConstrained());
+	}
+
+	FQEMSimplification Simplifier(&Mesh);
+	Simplifier.SetExternalConstraints(MoveTemp(Constraints));
+	Simplifier.SimplifyToTriangleCount(TriangleBudget);
+
+	// 지워진 정점 / 삼각형 자리를 빼고 다시 채움
+	TArray<int32> VertexRemap;
+	VertexRemap.Init(INDEX_NONE, Mesh.MaxVertexID());
+
+	InOutMeshData.Vertices.Reset();
+	InOutMeshData.Normals.Reset();
+	InOutMeshData.Colors.Reset();
+	InOutMeshData.Triangles.Reset();
+
+	for (const int32 VertexId : Mesh.VertexIndicesItr())
+	{
+		VertexRemap[VertexId] = InOutMeshData.Vertices.Add(Mesh.GetVertex(VertexId));
+		InOutMeshData.Normals.Add(FVector(Mesh.GetVertexNormal(VertexId)));
+	}
+
+	for (const int32 TriangleId : Mesh.TriangleIndicesItr())
+	{
+		const FIndex3i Triangle = Mesh.GetTriangle(TriangleId);
+		InOutMeshData.Triangles.Append({ VertexRemap[Triangle.A], VertexRemap[Triangle.B], VertexRemap[Triangle.C] });
+	}
+}
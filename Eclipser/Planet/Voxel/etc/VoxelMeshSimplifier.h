@@ -0,0 +1,12 @@
+#pragma once
+
+#include "Planet/Voxel/Defines/VoxelStructs.h"
+
+// 먼 LOD Chunk Mesh를 삼각형 예산까지 QEM Edge Collapse로 줄임
+// 열린 경계(Chunk 면)의 정점과 Edge는 고정해서 단순화하지 않은 이웃 Chunk와도 맞물림 유지
+class VoxelMeshSimplifier
+{
+public:
+	// TriangleBudget이 0이거나 이미 예산 이하면 그대로 둠
+	static void Simplify(FVoxelData& InOutMeshData, int32 TriangleBudget);
+};
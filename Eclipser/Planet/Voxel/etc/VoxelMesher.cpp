@@ -0,0 +1,39 @@
+#include "VoxelMesher.h"
+
+#include "Planet/MarchingCube/MarchingCubeMeshGenerator.h"
+#include "Planet/SurfaceNets/SurfaceNetsMeshGenerator.h"
+
+void VoxelMesher::GenerateChunkMesh(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData, FVoxelData& OutMeshData,
+	const FVoxelBrickMinMax* BrickMinMax)
+{
+	// Apron이 부족하면 이웃과 경계 정점이 어긋나므로 Seam이 항상 맞는 Marching Cube로 생성
+	const EVoxelMesherType MesherType = Info.Apron >= GetRequiredApron(Info.MesherType, Info.CellNum, Info.LODLevel)
+		? Info.MesherType
+		: EVoxelMesherType::MarchingCubes;
+
+	switch (MesherType)
+	{
+	case EVoxelMesherType::SurfaceNets:
+		SurfaceNetsMeshGenerator::GenerateChunkMesh(Info, VertexDensityData, OutMeshData, false, BrickMinMax);
+		break;
+	case EVoxelMesherType::DualContouring:
+		SurfaceNetsMeshGenerator::GenerateChunkMesh(Info, VertexDensityData, OutMeshData, true, BrickMinMax);
+		break;
+	case EVoxelMesherType::MarchingCubes:
+	default:
+		MarchingCubeMeshGenerator::GenerateChunkMesh(Info, VertexDensityData, OutMeshData, BrickMinMax);
+		break;
+	}
+}
+
+int32 VoxelMesher::GetRequiredApron(EVoxelMesherType MesherType, int32 CellNum, int32 LODLevel)
+{
+	if (MesherType == EVoxelMesherType::MarchingCubes || CellNum <= 0)
+		return 1;
+
+	// LOD Step으로 나누어 떨어지지 않으면 마지막 Cell은 남은 크기만큼 사용
+	// 경계 Cell 꼭짓점의 Gradient도 이웃과 같은 중심 차분이 되도록 한 칸 더 필요
+	const int32 Step = FMath::Max(LODLevel, 1);
+	const int32 BoundaryCellWidth = CellNum - (FMath::DivideAndRoundUp(CellNum, Step) - 1) * Step;
+	return BoundaryCellWidth + 1;
+}
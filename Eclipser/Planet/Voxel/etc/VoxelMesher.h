@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Planet/Voxel/Defines/VoxelStructs.h"
+
+// Info.MesherType에 맞는 Mesher로 Chunk Mesh 생성, Chunk 생성 / Sculpt / Collision이 모두 이 경로를 사용
+class VoxelMesher
+{
+public:
+	static void GenerateChunkMesh(const FChunkSettingInfo& Info, const TArray<FVertexDensity>& VertexDensityData, FVoxelData& OutMeshData,
+		const FVoxelBrickMinMax* BrickMinMax = nullptr);
+
+	// Dual Mesher의 음의 방향 경계 Cell은 이웃 Chunk의 마지막 Cell과 같은 크기여야 Seam이 맞으므로 그만큼 (+ Gradient용 1) Apron 꼭짓점이 필요
+	static int32 GetRequiredApron(EVoxelMesherType MesherType, int32 CellNum, int32 LODLevel);
+};
@@ -0,0 +1,169 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "VoxelMesher.h"
+#include "Planet/Voxel/Benchmark/VoxelTestHelper.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelDualMesherTest, "Eclipser.Voxel.Mesher.DualMeshers", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FVoxelDualMesherTest::RunTest(const FString& Parameters)
+{
+	const UEnum* MesherEnum = StaticEnum<EVoxelMesherType>();
+
+	// Surface Nets / Dual Contouring도 닫힌 Mesh, Marching Cube와 같은 감김 방향, 더 적은 삼각형이어야 함
+	for (const int32 LODLevel : { 1, 2 })
+	{
+		FChunkSettingInfo Info = VoxelTestHelper::MakeTestInfo(16, LODLevel);
+		Info.Apron = VoxelMesher::GetRequiredApron(EVoxelMesherType::SurfaceNets, Info.CellNum, LODLevel);
+		const FVector Center(7.81f, 8.13f, 7.93f);
+		const float Radius = 5.37f;
+
+		TArray<FVertexDensity> DensityData;
+		VoxelTestHelper::FillDensity(Info, [&](const FVector& CellPos) { return Radius - FVector::Dist(CellPos, Center); }, DensityData);
+
+		FVoxelData MarchingMesh;
+		VoxelMesher::GenerateChunkMesh(Info, DensityData, MarchingMesh);
+
+		for (const EVoxelMesherType MesherType : { EVoxelMesherType::SurfaceNets, EVoxelMesherType::DualContouring })
+		{
+			const FString Label = FString::Printf(TEXT("%s LOD=%d"), *MesherEnum->GetNameStringByValue(static_cast<int64>(MesherType)), LODLevel);
+			Info.MesherType = MesherType;
+
+			FVoxelData MeshData;
+			VoxelMesher::GenerateChunkMesh(Info, DensityData, MeshData);
+			if (!AddErrorIfFalse(MeshData.Triangles.Num() > 0, FString::Printf(TEXT("%s: sphere produced no triangles"), *Label)))
+				continue;
+
+			FString Error;
+			AddErrorIfFalse(VoxelTestHelper::IsClosedManifold(MeshData, Error), FString::Printf(TEXT("%s: %s"), *Label, *Error));
+			AddErrorIfFalse(MeshData.Triangles.Num() < MarchingMesh.Triangles.Num(),
+				FString::Printf(TEXT("%s: %d triangles, marching cubes %d"), *Label, MeshData.Triangles.Num() / 3, MarchingMesh.Triangles.Num() / 3));
+
+			// 삼각형 외적은 Solid 쪽, 정점 Normal은 바깥쪽을 향함
+			int32 Flipped = 0;
+			for (int32 t = 0; t + 2 < MeshData.Triangles.Num(); t += 3)
+			{
+				const int32 I0 = MeshData.Triangles[t], I1 = MeshData.Triangles[t + 1], I2 = MeshData.Triangles[t + 2];
+				const FVector FaceCross = FVector::CrossProduct(MeshData.Vertices[I1] - MeshData.Vertices[I0], MeshData.Vertices[I2] - MeshData.Vertices[I0]);
+				const FVector VertexNormal = MeshData.Normals[I0] + MeshData.Normals[I1] + MeshData.Normals[I2];
+				Flipped += FVector::DotProduct(FaceCross, VertexNormal) > 0.0f ? 1 : 0;
+			}
+			// 곡률이 큰 곳에서 사각형을 나눈 삼각형 일부는 뒤집힐 수 있어서 1%까지 허용
+			AddErrorIfFalse(Flipped * 100 <= MeshData.Triangles.Num() / 3,
+				FString::Printf(TEXT("%s: %d triangles wound against marching cubes"), *Label, Flipped));
+		}
+	}
+
+	// Dual Contouring은 격자에 맞지 않는 상자의 모서리와 꼭짓점도 면 위에 정점을 둬야 함
+	{
+		FChunkSettingInfo Info = VoxelTestHelper::MakeTestInfo(16, 1);
+		Info.MesherType = EVoxelMesherType::DualContouring;
+		Info.Apron = VoxelMesher::GetRequiredApron(Info.MesherType, Info.CellNum, Info.LODLevel);
+		const FVector Center(8.31f, 7.72f, 8.13f);
+		const float HalfSize = 4.35f;
+
+		auto BoxDensity = [&](const FVector& CellPos)
+		{
+			const FVector Offset = (CellPos - Center).GetAbs();
+			return HalfSize - Offset.GetMax();
+		};
+
+		TArray<FVertexDensity> DensityData;
+		VoxelTestHelper::FillDensity(Info, BoxDensity, DensityData);
+
+		FVoxelData MeshData;
+		VoxelMesher::GenerateChunkMesh(Info, DensityData, MeshData);
+
+		float MaxError = 0.0f;
+		const FVector ChunkHalfExtent(Info.ChunkSize * 0.5f);
+		for (const FVector& Vertex : MeshData.Vertices)
+		{
+			MaxError = FMath::Max(MaxError, FMath::Abs(BoxDensity((Vertex + ChunkHalfExtent) / Info.CellSize)));
+		}
+		AddErrorIfFalse(MeshData.Vertices.Num() > 0 && MaxError < 0.25f,
+			FString::Printf(TEXT("Dual contouring box vertices are up to %.3f cells off the surface"), MaxError));
+	}
+
+	// +X 방향으로 맞닿은 같은 LOD의 두 Chunk는 경계 Cell 정점이 위치와 Normal까지 같아야 Seam이 생기지 않음
+	struct FSeamCase
+	{
+		int32 CellNum;
+		int32 LODLevel;
+	};
+	for (const FSeamCase& Case : { FSeamCase{16, 1}, FSeamCase{16, 2}, FSeamCase{16, 4}, FSeamCase{10, 4} })
+	{
+		for (const EVoxelMesherType MesherType : { EVoxelMesherType::SurfaceNets, EVoxelMesherType::DualContouring })
+		{
+			const FString Label = FString::Printf(TEXT("%s CellNum=%d LOD=%d seam"),
+				*MesherEnum->GetNameStringByValue(static_cast<int64>(MesherType)), Case.CellNum, Case.LODLevel);
+
+			FChunkSettingInfo Info = VoxelTestHelper::MakeTestInfo(Case.CellNum, Case.LODLevel);
+			Info.MesherType = MesherType;
+			Info.Apron = VoxelMesher::GetRequiredApron(MesherType, Info.CellNum, Info.LODLevel);
+
+			// 두 Chunk 경계(x = CellNum)를 지나는 구
+			const FVector Center(Case.CellNum + 0.31f, Case.CellNum * 0.47f, Case.CellNum * 0.53f);
+			const float Radius = Case.CellNum * 0.38f;
+			const FVector NeighborShift(Case.CellNum, 0.0f, 0.0f);
+
+			TArray<FVertexDensity> DensityData;
+			TArray<FVertexDensity> NeighborDensityData;
+			VoxelTestHelper::FillDensity(Info, [&](const FVector& CellPos) { return Radius - FVector::Dist(CellPos, Center); }, DensityData);
+			VoxelTestHelper::FillDensity(Info, [&](const FVector& CellPos) { return Radius - FVector::Dist(CellPos + NeighborShift, Center); }, NeighborDensityData);
+
+			FVoxelData MeshData;
+			FVoxelData NeighborMeshData;
+			VoxelMesher::GenerateChunkMesh(Info, DensityData, MeshData);
+			VoxelMesher::GenerateChunkMesh(Info, NeighborDensityData, NeighborMeshData);
+
+			// 이웃의 음의 방향 경계 Cell 정점과 이 Chunk의 마지막 Cell 정점을 같은 좌표계로 모음
+			const int32 Step = FMath::Max(Info.LODLevel, 1);
+			const double HalfExtent = Info.ChunkSize * 0.5;
+			const double LastCellMinX = ((FMath::DivideAndRoundUp(Info.CellNum, Step) - 1) * Step) * static_cast<double>(Info.CellSize) - HalfExtent;
+			TArray<int32> LastCellVertices;
+			TArray<int32> BoundaryCellVertices;
+			for (int32 i = 0; i < MeshData.Vertices.Num(); ++i)
+			{
+				if (MeshData.Vertices[i].X > LastCellMinX)
+					LastCellVertices.Add(i);
+			}
+			for (int32 i = 0; i < NeighborMeshData.Vertices.Num(); ++i)
+			{
+				if (NeighborMeshData.Vertices[i].X < -HalfExtent)
+					BoundaryCellVertices.Add(i);
+			}
+
+			if (!AddErrorIfFalse(BoundaryCellVertices.Num() > 0 && BoundaryCellVertices.Num() == LastCellVertices.Num(),
+				FString::Printf(TEXT("%s: %d boundary cell vertices, neighbor has %d in its last cell"), *Label, BoundaryCellVertices.Num(), LastCellVertices.Num())))
+				continue;
+
+			double MaxPositionError = 0.0;
+			double MaxNormalError = 0.0;
+			for (const int32 BoundaryIndex : BoundaryCellVertices)
+			{
+				const FVector Position = NeighborMeshData.Vertices[BoundaryIndex] + FVector(Info.ChunkSize, 0.0, 0.0);
+				int32 Nearest = INDEX_NONE;
+				double NearestDistance = TNumericLimits<double>::Max();
+				for (const int32 LastIndex : LastCellVertices)
+				{
+					const double Distance = FVector::Dist(Position, MeshData.Vertices[LastIndex]);
+					if (Distance < NearestDistance)
+					{
+						NearestDistance = Distance;
+						Nearest = LastIndex;
+					}
+				}
+				MaxPositionError = FMath::Max(MaxPositionError, NearestDistance);
+				MaxNormalError = FMath::Max(MaxNormalError, FVector::Dist(NeighborMeshData.Normals[BoundaryIndex], MeshData.Normals[Nearest]));
+			}
+
+			AddErrorIfFalse(MaxPositionError < 0.01 && MaxNormalError < 1e-3,
+				FString::Printf(TEXT("%s: shared vertices differ by up to %.4f units, normals by %.5f"), *Label, MaxPositionError, MaxNormalError));
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,170 @@
+#include "VoxelSculptCodec.h"
+
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	// Radius 값 아래 2bit에 Mode를 같이 기록
+	constexpr uint32 SculptModeBits = 2;
+	constexpr uint32 SculptModeMask = (1u << SculptModeBits) - 1;
+}
+
+FVoxelSculptOp VoxelSculptCodec::Quantize(const FVoxelSculptOp& Op, int32 CellSize)
+{
+	FVoxelSculptOp Result = Op;
+	Result.LocalCenter.X = FromSteps(ToSteps(Op.LocalCenter.X, CellSize), CellSize);
+	Result.LocalCenter.Y = FromSteps(ToSteps(Op.LocalCenter.Y, CellSize), CellSize);
+	Result.LocalCenter.Z = FromSteps(ToSteps(Op.LocalCenter.Z, CellSize), CellSize);
+	Result.Radius = FromSteps(FMath::Max(1, ToSteps(Op.Radius, CellSize)), CellSize);
+	return Result;
+}
+
+void VoxelSculptCodec::EncodeOps(TConstArrayView<FVoxelSculptOp> Ops, int32 CellSize, TArray<uint8>& OutBytes)
+{
+	OutBytes.Reset();
+	FMemoryWriter Writer(OutBytes);
+
+	uint32 Count = Ops.Num();
+	Writer.SerializeIntPacked(Count);
+
+	// 같은 자리를 연속으로 파는 경우가 대부분이라 차이 값은 보통 1 ~ 2 Byte
+	FIntVector Previous = FIntVector::ZeroValue;
+	for (const FVoxelSculptOp& Op : Ops)
+	{
+		const FIntVector Steps(ToSteps(Op.LocalCenter.X, CellSize), ToSteps(Op.LocalCenter.Y, CellSize), ToSteps(Op.LocalCenter.Z, CellSize));
+		uint32 DeltaX = ZigZag(Steps.X - Previous.X);
+		uint32 DeltaY = ZigZag(Steps.Y - Previous.Y);
+		uint32 DeltaZ = ZigZag(Steps.Z - Previous.Z);
+		uint32 RadiusAndMode = (static_cast<uint32>(FMath::Max(1, ToSteps(Op.Radius, CellSize))) << SculptModeBits)
+			| (static_cast<uint32>(Op.Mode) & SculptModeMask);
+
+		Writer.SerializeIntPacked(DeltaX);
+		Writer.SerializeIntPacked(DeltaY);
+		Writer.SerializeIntPacked(DeltaZ);
+		Writer.SerializeIntPacked(RadiusAndMode);
+		Previous = Steps;
+	}
+}
+
+bool VoxelSculptCodec::DecodeOps(const TArray<uint8>& Bytes, int32 CellSize, TArray<FVoxelSculptOp>& OutOps)
+{
+	OutOps.Reset();
+	FMemoryReader Reader(Bytes);
+
+	uint32 Count = 0;
+	Reader.SerializeIntPacked(Count);
+	// 연산 하나는 최소 4 Byte
+	if (Reader.IsError() || Count > static_cast<uint32>(Bytes.Num()) / 4)
+		return false;
+
+	OutOps.Reserve(Count);
+	FIntVector Previous = FIntVector::ZeroValue;
+	for (uint32 i = 0; i < Count; ++i)
+	{
+		uint32 DeltaX = 0, DeltaY = 0, DeltaZ = 0, RadiusAndMode = 0;
+		Reader.SerializeIntPacked(DeltaX);
+		Reader.SerializeIntPacked(DeltaY);
+		Reader.SerializeIntPacked(DeltaZ);
+		Reader.SerializeIntPacked(RadiusAndMode);
+		if (Reader.IsError())
+			return false;
+
+		const uint32 Mode = RadiusAndMode & SculptModeMask;
+		if (Mode > static_cast<uint32>(EVoxelSculptMode::Dig))
+			return false;
+
+		Previous += FIntVector(UnZigZag(DeltaX), UnZigZag(DeltaY), UnZigZag(DeltaZ));
+
+		FVoxelSculptOp& Op = OutOps.AddDefaulted_GetRef();
+		Op.LocalCenter = FVector3f(FromSteps(Previous.X, CellSize), FromSteps(Previous.Y, CellSize), FromSteps(Previous.Z, CellSize));
+		Op.Radius = FromSteps(static_cast<int32>(RadiusAndMode >> SculptModeBits), CellSize);
+		Op.Mode = static_cast<EVoxelSculptMode>(Mode);
+	}
+	return true;
+}
+
+void VoxelSculptCodec::EncodeChunkOverrides(TConstArrayView<TPair<int32, FFloat16>> Overrides, TArray<uint8>& OutBytes)
+{
+	TArray<uint8> Payload;
+	FMemoryWriter Writer(Payload);
+
+	uint32 Count = Overrides.Num();
+	Writer.SerializeIntPacked(Count);
+
+	// 파낸 영역은 Index가 몰려 있어서 차이 값이 작고, Density도 비슷한 값이 반복되어 압축이 잘 됨
+	int32 PreviousIndex = -1;
+	for (const TPair<int32, FFloat16>& Override : Overrides)
+	{
+		uint32 Delta = static_cast<uint32>(Override.Key - PreviousIndex);
+		Writer.SerializeIntPacked(Delta);
+		PreviousIndex = Override.Key;
+	}
+	for (const TPair<int32, FFloat16>& Override : Overrides)
+	{
+		uint16 Encoded = Override.Value.Encoded;
+		Writer << Encoded;
+	}
+
+	OutBytes.Reset();
+	FMemoryWriter Header(OutBytes);
+	int32 UncompressedSize = Payload.Num();
+	Header << UncompressedSize;
+
+	const int64 CompressedOffset = OutBytes.Num();
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, UncompressedSize);
+	OutBytes.SetNumUninitialized(CompressedOffset + CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Oodle, OutBytes.GetData() + CompressedOffset, CompressedSize, Payload.GetData(), UncompressedSize))
+	{
+		OutBytes.Reset();
+		return;
+	}
+	OutBytes.SetNum(CompressedOffset + CompressedSize);
+}
+
+bool VoxelSculptCodec::DecodeChunkOverrides(const TArray<uint8>& Bytes, TArray<TPair<int32, FFloat16>>& OutOverrides)
+{
+	OutOverrides.Reset();
+	FMemoryReader Header(Bytes);
+
+	int32 UncompressedSize = 0;
+	Header << UncompressedSize;
+	// 악의적인 크기로 큰 할당을 하지 않도록 Chunk 하나의 최대 Density 개수 수준으로 제한
+	if (Header.IsError() || UncompressedSize <= 0 || UncompressedSize > 16 * 1024 * 1024)
+		return false;
+
+	TArray<uint8> Payload;
+	Payload.SetNumUninitialized(UncompressedSize);
+	const int64 CompressedOffset = Header.Tell();
+	if (!FCompression::UncompressMemory(NAME_Oodle, Payload.GetData(), UncompressedSize,
+		Bytes.GetData() + CompressedOffset, Bytes.Num() - CompressedOffset))
+		return false;
+
+	FMemoryReader Reader(Payload);
+	uint32 Count = 0;
+	Reader.SerializeIntPacked(Count);
+	// 항목 하나는 최소 3 Byte (Index 차이 1 + Half 2)
+	if (Reader.IsError() || Count > static_cast<uint32>(UncompressedSize) / 3)
+		return false;
+
+	OutOverrides.SetNum(Count);
+	int32 Index = -1;
+	for (TPair<int32, FFloat16>& Override : OutOverrides)
+	{
+		uint32 Delta = 0;
+		Reader.SerializeIntPacked(Delta);
+		if (Delta == 0)
+			return false;
+
+		Index += static_cast<int32>(Delta);
+		Override.Key = Index;
+	}
+	for (TPair<int32, FFloat16>& Override : OutOverrides)
+	{
+		uint16 Encoded = 0;
+		Reader << Encoded;
+		Override.Value.Encoded = Encoded;
+	}
+	return !Reader.IsError();
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Planet/Voxel/Defines/VoxelEnums.h"
+
+// 서버가 확정한 Brush 연산, Manager 위치 기준 Local 좌표
+struct FVoxelSculptOp
+{
+	FVector3f LocalCenter = FVector3f::ZeroVector;
+	float Radius = 0.0f;
+	EVoxelSculptMode Mode = EVoxelSculptMode::Dig;
+};
+
+/*
+ * Sculpt 네트워크 전송용 인코딩
+ * Brush 연산 : 1 Cell을 SubCellSteps 등분한 격자로 양자화, 앞 연산 중심과의 차이를 가변 길이 정수로 기록
+ * Snapshot : Chunk 하나의 Sculpt 기록(꼭짓점 Index -> Half Density)을 Index 차이 + Half 값으로 적고 Oodle 압축
+ */
+class VoxelSculptCodec
+{
+public:
+	static constexpr int32 SubCellSteps = 16;
+
+	// 서버도 양자화한 값으로 적용해야 Client와 결과가 같음
+	static FVoxelSculptOp Quantize(const FVoxelSculptOp& Op, int32 CellSize);
+
+	static void EncodeOps(TConstArrayView<FVoxelSculptOp> Ops, int32 CellSize, TArray<uint8>& OutBytes);
+	static bool DecodeOps(const TArray<uint8>& Bytes, int32 CellSize, TArray<FVoxelSculptOp>& OutOps);
+
+	// Overrides는 Index 오름차순
+	static void EncodeChunkOverrides(TConstArrayView<TPair<int32, FFloat16>> Overrides, TArray<uint8>& OutBytes);
+	static bool DecodeChunkOverrides(const TArray<uint8>& Bytes, TArray<TPair<int32, FFloat16>>& OutOverrides);
+
+private:
+	static uint32 ZigZag(int32 Value) { return (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31); }
+	static int32 UnZigZag(uint32 Value) { return static_cast<int32>(Value >> 1) ^ -static_cast<int32>(Value & 1); }
+	static int32 ToSteps(float Value, int32 CellSize) { return FMath::RoundToInt(Value * SubCellSteps / CellSize); }
+	static float FromSteps(int32 Steps, int32 CellSize) { return static_cast<float>(Steps) * CellSize / SubCellSteps; }
+};
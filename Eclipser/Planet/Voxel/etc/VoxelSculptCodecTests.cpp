@@ -0,0 +1,65 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "VoxelSculptCodec.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelSculptCodecTest, "Eclipser.Voxel.SculptCodec", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FVoxelSculptCodecTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 CellSize = 100;
+
+	// 양자화한 연산은 인코딩 후에도 정확히 같은 값이어야 서버와 Client의 Density가 같음
+	TArray<FVoxelSculptOp> Ops;
+	FRandomStream Random(1234);
+	for (int32 i = 0; i < 64; ++i)
+	{
+		FVoxelSculptOp Op;
+		Op.LocalCenter = FVector3f(Random.FRandRange(-12800.0f, 12800.0f), Random.FRandRange(-12800.0f, 12800.0f), Random.FRandRange(-12800.0f, 12800.0f));
+		Op.Radius = Random.FRandRange(10.0f, 800.0f);
+		Ops.Add(VoxelSculptCodec::Quantize(Op, CellSize));
+	}
+
+	TArray<uint8> Bytes;
+	VoxelSculptCodec::EncodeOps(Ops, CellSize, Bytes);
+	TArray<FVoxelSculptOp> DecodedOps;
+	if (AddErrorIfFalse(VoxelSculptCodec::DecodeOps(Bytes, CellSize, DecodedOps) && DecodedOps.Num() == Ops.Num(), TEXT("Sculpt batch did not decode")))
+	{
+		for (int32 i = 0; i < Ops.Num(); ++i)
+		{
+			if (!AddErrorIfFalse(DecodedOps[i].LocalCenter == Ops[i].LocalCenter && DecodedOps[i].Radius == Ops[i].Radius && DecodedOps[i].Mode == Ops[i].Mode,
+				FString::Printf(TEXT("Op %d changed after encoding"), i)))
+				break;
+		}
+	}
+	AddErrorIfFalse(Bytes.Num() <= Ops.Num() * 16, FString::Printf(TEXT("Sculpt batch used %d bytes for %d ops"), Bytes.Num(), Ops.Num()));
+
+	Bytes.SetNum(Bytes.Num() / 2);
+	AddErrorIfFalse(!VoxelSculptCodec::DecodeOps(Bytes, CellSize, DecodedOps), TEXT("Truncated sculpt batch was accepted"));
+
+	// Snapshot 기록은 Index와 Half 값이 그대로 복원되어야 함
+	TArray<TPair<int32, FFloat16>> Overrides;
+	for (int32 Index = 100; Index < 4000; Index += 1 + (Index % 7))
+	{
+		Overrides.Emplace(Index, FFloat16(-static_cast<float>(Index % 13) * 10.0f));
+	}
+
+	VoxelSculptCodec::EncodeChunkOverrides(Overrides, Bytes);
+	TArray<TPair<int32, FFloat16>> DecodedOverrides;
+	if (AddErrorIfFalse(VoxelSculptCodec::DecodeChunkOverrides(Bytes, DecodedOverrides) && DecodedOverrides.Num() == Overrides.Num(),
+		TEXT("Sculpt snapshot did not decode")))
+	{
+		for (int32 i = 0; i < Overrides.Num(); ++i)
+		{
+			if (!AddErrorIfFalse(DecodedOverrides[i].Key == Overrides[i].Key && DecodedOverrides[i].Value.Encoded == Overrides[i].Value.Encoded,
+				FString::Printf(TEXT("Snapshot entry %d changed after encoding"), i)))
+				break;
+		}
+	}
+	AddErrorIfFalse(Bytes.Num() < Overrides.Num() * 3, FString::Printf(TEXT("Sculpt snapshot used %d bytes for %d entries"), Bytes.Num(), Overrides.Num()));
+
+	return true;
+}
+
+#endif